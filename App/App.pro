@@ -0,0 +1,50 @@
+QT       += \
+    core gui \
+    gamepad
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += \ c++17
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+TARGET = GP4k
+
+include(../GP4k_Engine.pri)
+
+SOURCES += \
+    $$PWD/../Sources/GamepadInput.cpp \
+    $$PWD/../Sources/GuideWidget.cpp \
+    $$PWD/../Sources/GuiScale.cpp \
+    $$PWD/../Sources/ImageWidget.cpp \
+    $$PWD/../Sources/InputReplayer.cpp \
+    $$PWD/../Sources/PlainTextFieldWidget.cpp \
+    $$PWD/../Sources/RasterAtlas.cpp \
+    $$PWD/../Sources/StartupProbe.cpp \
+    $$PWD/../Sources/TextFieldWidget.cpp \
+    $$PWD/../Sources/TileBackgroundCache.cpp \
+    $$PWD/../Sources/WheelWidget.cpp \
+    $$PWD/../Sources/main.cpp \
+    $$PWD/../Sources/mainwindow.cpp
+
+HEADERS += \
+    $$PWD/../Headers/GP4k_GuiMapping.h \
+    $$PWD/../Headers/GamepadInput.h \
+    $$PWD/../Headers/GuideWidget.h \
+    $$PWD/../Headers/GuiScale.h \
+    $$PWD/../Headers/ImageWidget.h \
+    $$PWD/../Headers/InputReplayer.h \
+    $$PWD/../Headers/PlainTextFieldWidget.h \
+    $$PWD/../Headers/RasterAtlas.h \
+    $$PWD/../Headers/StartupProbe.h \
+    $$PWD/../Headers/TextFieldWidget.h \
+    $$PWD/../Headers/TileBackgroundCache.h \
+    $$PWD/../Headers/WheelWidget.h \
+    $$PWD/../Headers/mainwindow.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
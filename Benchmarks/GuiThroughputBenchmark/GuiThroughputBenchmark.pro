@@ -0,0 +1,37 @@
+# GUI throughput benchmark: drives scripted gamepad sequences into the full
+# window, offscreen, and reports events/s, paint time and signal counts.
+
+QT += core gui widgets gamepad
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-gui-benchmark
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    $$PWD/../../Sources/GamepadInput.cpp \
+    $$PWD/../../Sources/GuideWidget.cpp \
+    $$PWD/../../Sources/GuiScale.cpp \
+    $$PWD/../../Sources/ImageWidget.cpp \
+    $$PWD/../../Sources/PlainTextFieldWidget.cpp \
+    $$PWD/../../Sources/RasterAtlas.cpp \
+    $$PWD/../../Sources/TextFieldWidget.cpp \
+    $$PWD/../../Sources/TileBackgroundCache.cpp \
+    $$PWD/../../Sources/WheelWidget.cpp \
+    $$PWD/../../Sources/mainwindow.cpp \
+    main.cpp
+
+HEADERS += \
+    $$PWD/../../Headers/GP4k_GuiMapping.h \
+    $$PWD/../../Headers/GamepadInput.h \
+    $$PWD/../../Headers/GuideWidget.h \
+    $$PWD/../../Headers/GuiScale.h \
+    $$PWD/../../Headers/ImageWidget.h \
+    $$PWD/../../Headers/PlainTextFieldWidget.h \
+    $$PWD/../../Headers/RasterAtlas.h \
+    $$PWD/../../Headers/TextFieldWidget.h \
+    $$PWD/../../Headers/TileBackgroundCache.h \
+    $$PWD/../../Headers/WheelWidget.h \
+    $$PWD/../../Headers/mainwindow.h
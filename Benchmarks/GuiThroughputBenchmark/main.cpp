@@ -0,0 +1,171 @@
+#include <cmath>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include "Headers/GuiScale.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/mainwindow.h"
+
+/**
+ * @def STICK_AMPLITUDE
+ * @brief The radius at which the script pushes the sticks, as the TypingSimulator does.
+ */
+#define STICK_AMPLITUDE 0.9
+
+/**
+ * @brief A scripted gamepad event.
+ */
+struct ScriptedEvent_t {
+    GamepadInput_t Input;  /**< The physical input. */
+    double Value;          /**< Its new value. */
+};
+
+/**
+ * @brief The PaintCounter class counts the paint events received by every widget of the application.
+ */
+class PaintCounter : public QObject
+{
+public:
+    /**
+     * @brief Counts the paint events, without filtering them.
+     * @param Watched The object receiving the event.
+     * @param Event The event.
+     * @return False, so the event is delivered.
+     */
+    bool eventFilter(QObject *Watched, QEvent *Event) override{
+        if(Event->type() == QEvent::Paint){
+            Paints++;
+        }
+        return QObject::eventFilter(Watched, Event);
+    }
+
+    /**
+     * @brief The paint events received so far.
+     */
+    quint64 Paints = 0;
+};
+
+/**
+ * @brief Appends a stick moved to a tile and released.
+ * @param Script The script.
+ * @param Stick The stick.
+ * @param Tile The tile to point.
+ */
+static void AppendStickMove(QVector<ScriptedEvent_t> &Script, const stick_t Stick, const uint8_t Tile){
+    const GamepadInput_t InputX = (Stick == STICK_LEFT) ? INPUT_AXIS_LEFT_X : INPUT_AXIS_RIGHT_X;
+    const GamepadInput_t InputY = (Stick == STICK_LEFT) ? INPUT_AXIS_LEFT_Y : INPUT_AXIS_RIGHT_Y;
+    const double Angle = (Tile * 45.0 - 180.0) * M_PI / 180.0;
+    Script.append({InputX, STICK_AMPLITUDE * cos(Angle)});
+    Script.append({InputY, STICK_AMPLITUDE * sin(Angle)});
+    Script.append({InputX, 0.0});
+    Script.append({InputY, 0.0});
+}
+
+/**
+ * @brief Appends a button pressed and released.
+ * @param Script The script.
+ * @param Button The button.
+ */
+static void AppendButtonPress(QVector<ScriptedEvent_t> &Script, const GamepadInput_t Button){
+    Script.append({Button, 1.0});
+    Script.append({Button, 0.0});
+}
+
+/**
+ * @brief Builds a deterministic typing session: a group and a char per step, with spaces, backspaces and shifts.
+ * @param Steps The chars to type.
+ * @return The events of the session.
+ */
+static QVector<ScriptedEvent_t> BuildScript(const int Steps){
+    QVector<ScriptedEvent_t> Script;
+    for(int Step = 0; Step < Steps; Step++){
+        const uint8_t Group = Step % NUMBER_OF_TILES;
+        const int CharsCount = KeyboardLayout::Active().InnerChars(NOT_SHIFTED, Group).length();
+        AppendStickMove(Script, STICK_LEFT, Group);
+        AppendStickMove(Script, STICK_RIGHT, (Step * 3) % CharsCount);
+        if(Step % 5 == 4){ AppendButtonPress(Script, INPUT_BUTTON_Y); }    // Space
+        if(Step % 17 == 16){ AppendButtonPress(Script, INPUT_BUTTON_X); }  // Backspace
+        if(Step % 23 == 22){ AppendButtonPress(Script, INPUT_BUTTON_LT); } // Shift
+    }
+    return Script;
+}
+
+int main(int argc, char *argv[])
+{
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")){
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Measures the gamepad events per second the whole window can absorb.");
+    Parser.addHelpOption();
+    const QCommandLineOption StepsOption("steps", "Chars typed by the script.", "count", "500");
+    const QCommandLineOption PlainTextOption("plain-text", "Use the plain text field.");
+    Parser.addOptions({StepsOption, PlainTextOption});
+    Parser.process(a);
+    const int Steps = qMax(Parser.value(StepsOption).toInt(), 1);
+
+    GuiScale::Initialize(1.0); // Same pixels on every machine
+    MainWindow w(-1, Parser.isSet(PlainTextOption) ? TEXT_FIELD_PLAIN : TEXT_FIELD_RICH);
+    Controller *GP4k_Controller = w.GetController();
+    if(!Trie::Shared()->IsLoaded()){
+        return 2;
+    }
+    GP4k_Controller->SetDictionary(Trie::Shared()); // Measures the GUI, not the background loading
+    w.show();
+    QApplication::processEvents();
+
+    PaintCounter Counter;
+    a.installEventFilter(&Counter);
+    const QVector<ScriptedEvent_t> Script = BuildScript(Steps);
+    const quint64 EmissionsBefore = GP4k_Controller->GetEmissions();
+    const WheelStats_t WheelBefore = w.GetWheel()->GetStats();
+
+    /* Each event is handled, then the event loop lays out and paints what
+     * it changed before the next one, as with a live gamepad. */
+    qint64 HandlingTime = 0;
+    qint64 FrameTime = 0;
+    quint64 Frames = 0;
+    QElapsedTimer Clock;
+    QElapsedTimer WallClock;
+    WallClock.start();
+    for(const ScriptedEvent_t &Event : Script){
+        Clock.restart();
+        GP4k_Controller->HandleInput(Event.Input, Event.Value);
+        HandlingTime += Clock.nsecsElapsed();
+
+        const quint64 PaintsBefore = Counter.Paints;
+        Clock.restart();
+        QApplication::processEvents();
+        const qint64 Elapsed = Clock.nsecsElapsed();
+        if(Counter.Paints > PaintsBefore){
+            Frames++;
+            FrameTime += Elapsed;
+        }
+    }
+    const qint64 WallTime = WallClock.nsecsElapsed();
+    a.removeEventFilter(&Counter);
+
+    const int Events = Script.size();
+    const quint64 Emissions = GP4k_Controller->GetEmissions() - EmissionsBefore;
+    const WheelStats_t Wheel = w.GetWheel()->GetStats();
+    const ViewModelStats_t ViewModel = GP4k_Controller->GetViewModelStats();
+    QTextStream Out(stdout);
+    Out << "events: " << Events << "\n"
+        << "events_per_s: " << Events / (WallTime / 1e9) << "\n"
+        << "handling_ns_per_event: " << HandlingTime / Events << "\n"
+        << "frames: " << Frames << "\n"
+        << "frame_us: " << ((Frames > 0) ? FrameTime / static_cast<qint64>(Frames) / 1000.0 : 0.0) << "\n"
+        << "paint_events_per_frame: " << ((Frames > 0) ? static_cast<double>(Counter.Paints) / Frames : 0.0) << "\n"
+        << "signals_per_event: " << static_cast<double>(Emissions) / Events << "\n"
+        << "wheel_slot_calls_per_event: " << static_cast<double>(Wheel.SlotCalls - WheelBefore.SlotCalls) / Events << "\n"
+        << "wheel_repaints_per_event: " << static_cast<double>(Wheel.Repaints - WheelBefore.Repaints) / Events << "\n"
+        << "suppressed_wheel_updates: " << ViewModel.SuppressedFields << "\n"
+        << "typed_chars: " << w.GetTypedText().length() << "\n";
+
+    return 0;
+}
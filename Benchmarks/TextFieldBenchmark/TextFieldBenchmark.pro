@@ -0,0 +1,24 @@
+# Text field benchmark: compares the typing latency of the rich text field,
+# driven by key events, to the plain one, on growing documents.
+
+QT += core gui widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-textfield-benchmark
+
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    $$PWD/../../Sources/GuiScale.cpp \
+    $$PWD/../../Sources/PlainTextFieldWidget.cpp \
+    $$PWD/../../Sources/TextFieldWidget.cpp \
+    main.cpp
+
+HEADERS += \
+    $$PWD/../../Headers/GP4k_GuiMapping.h \
+    $$PWD/../../Headers/GP4k_Typedefs.h \
+    $$PWD/../../Headers/GuiScale.h \
+    $$PWD/../../Headers/PlainTextFieldWidget.h \
+    $$PWD/../../Headers/TextFieldWidget.h
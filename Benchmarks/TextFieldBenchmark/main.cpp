@@ -0,0 +1,145 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QPair>
+#include <QTextStream>
+#include <QVector>
+
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/PlainTextFieldWidget.h"
+#include "Headers/TextFieldWidget.h"
+
+/**
+ * @brief Mean latencies of the edits typed at the end of a document.
+ */
+struct Latency_t {
+    qint64 Insert;     /**< Nanoseconds per typed char. */
+    qint64 Backspace;  /**< Nanoseconds per deleted char. */
+};
+
+/**
+ * @brief Builds a document of chat-like lines.
+ * @param Size The size of the document, in chars.
+ * @return The document.
+ */
+static QString BuildDocument(const int Size){
+    const QString Line = "the quick brown fox jumps over the lazy dog, again and again\n";
+    QString Document;
+    Document.reserve(Size + Line.size());
+    while(Document.size() < Size){
+        Document.append(Line);
+    }
+    Document.truncate(Size);
+    return Document;
+}
+
+/**
+ * @brief Types then deletes chars at the end of a document, the way the Controller drives the text field.
+ * @param Insert Types a char.
+ * @param Backspace Deletes the char before the cursor.
+ * @param Iterations The chars to type, then to delete.
+ * @return The mean latency of each edit, painting included.
+ */
+template<typename InsertFunction, typename BackspaceFunction>
+static Latency_t MeasureEdits(InsertFunction Insert, BackspaceFunction Backspace, const int Iterations){
+    QElapsedTimer Clock;
+    Clock.start();
+    for(int Iteration = 0; Iteration < Iterations; Iteration++){
+        Insert();
+        QApplication::processEvents(); // Lays out and paints the edit
+    }
+    const qint64 InsertTime = Clock.nsecsElapsed();
+    Clock.restart();
+    for(int Iteration = 0; Iteration < Iterations; Iteration++){
+        Backspace();
+        QApplication::processEvents();
+    }
+    const qint64 BackspaceTime = Clock.nsecsElapsed();
+    return {InsertTime / Iterations, BackspaceTime / Iterations};
+}
+
+int main(int argc, char *argv[])
+{
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")){
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Measures the typing latency of the text fields on growing documents.");
+    Parser.addHelpOption();
+    const QCommandLineOption IterationsOption("iterations", "Chars typed then deleted per document size.", "count", "200");
+    const QCommandLineOption ThresholdOption("threshold", "Check that the plain text field stays flat: exit with 1 if a "
+                                             "plain growth exceeds 1 by more than this relative slowdown.", "ratio");
+    Parser.addOptions({IterationsOption, ThresholdOption});
+    Parser.process(a);
+    const int Iterations = qMax(Parser.value(IterationsOption).toInt(), 1);
+
+    QTextStream Out(stdout);
+    Out << "edits_per_size: " << Iterations << "\n";
+    QVector<Latency_t> RichLatencies;
+    QVector<Latency_t> PlainLatencies;
+    const QVector<int> Sizes{1024, 64 * 1024, 256 * 1024, 1024 * 1024};
+    for(const int Size : Sizes){
+        const QString Document = BuildDocument(Size);
+
+        // Before: rich text, chars inserted at the widget's cursor and orders sent as key events
+        QTextEditCustom RichField;
+        RichField.SetGeometryOnGrid(Placements["TextField"]);
+        RichField.setPlainText(Document);
+        RichField.moveCursor(QTextCursor::End);
+        RichField.show();
+        QApplication::processEvents();
+        const Latency_t Rich = MeasureEdits([&RichField](){ RichField.insertPlainText("a"); },
+                                            [&RichField](){ RichField.OrderReceived(Qt::Key_Backspace); }, Iterations);
+        RichField.hide();
+
+        // After: plain text, edits applied on a cursor, one edit block per event
+        PlainTextFieldWidget PlainField;
+        PlainField.SetGeometryOnGrid(Placements["TextField"]);
+        PlainField.setPlainText(Document);
+        PlainField.moveCursor(QTextCursor::End);
+        PlainField.show();
+        QApplication::processEvents();
+        const Latency_t Plain = MeasureEdits([&PlainField](){ PlainField.InsertText("a"); PlainField.EndEditBlock(); },
+                                             [&PlainField](){ PlainField.OrderReceived(Qt::Key_Backspace); PlainField.EndEditBlock(); },
+                                             Iterations);
+        PlainField.hide();
+
+        const QString Kib = QString::number(Size / 1024) + "k";
+        Out << "rich_insert_ns_" << Kib << ": " << Rich.Insert << "\n"
+            << "rich_backspace_ns_" << Kib << ": " << Rich.Backspace << "\n"
+            << "plain_insert_ns_" << Kib << ": " << Plain.Insert << "\n"
+            << "plain_backspace_ns_" << Kib << ": " << Plain.Backspace << "\n";
+        RichLatencies.append(Rich);
+        PlainLatencies.append(Plain);
+    }
+
+    // Flat latency: the largest document is about as fast as the smallest one
+    auto Growth = [](const qint64 Large, const qint64 Small){ return static_cast<double>(Large) / qMax(Small, static_cast<qint64>(1)); };
+    const QVector<QPair<QString, double>> PlainGrowths{
+        {"plain_insert_growth", Growth(PlainLatencies.last().Insert, PlainLatencies.first().Insert)},
+        {"plain_backspace_growth", Growth(PlainLatencies.last().Backspace, PlainLatencies.first().Backspace)}
+    };
+    Out << "rich_insert_growth: " << Growth(RichLatencies.last().Insert, RichLatencies.first().Insert) << "\n"
+        << "rich_backspace_growth: " << Growth(RichLatencies.last().Backspace, RichLatencies.first().Backspace) << "\n";
+    for(const QPair<QString, double> &PlainGrowth : PlainGrowths){
+        Out << PlainGrowth.first << ": " << PlainGrowth.second << "\n";
+    }
+
+    if(Parser.isSet(ThresholdOption)){
+        // Only the plain text field is meant to be flat: the rich one is the reference it's compared to
+        const double Threshold = Parser.value(ThresholdOption).toDouble();
+        int Regressions = 0;
+        for(const QPair<QString, double> &PlainGrowth : PlainGrowths){
+            if(PlainGrowth.second > 1.0 + Threshold){
+                Out << "regression: " << PlainGrowth.first << " | threshold " << 1.0 + Threshold
+                    << " | now " << PlainGrowth.second << "\n";
+                Regressions++;
+            }
+        }
+        Out << "regressions: " << Regressions << "\n";
+        return (Regressions > 0) ? 1 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,25 @@
+# Selection change benchmark: compares the tile backgrounds read from their SVG
+# at each change to the WheelWidget, drawing from the TileBackgroundCache.
+
+QT += core gui widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-tile-benchmark
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    $$PWD/../../Sources/GuiScale.cpp \
+    $$PWD/../../Sources/RasterAtlas.cpp \
+    $$PWD/../../Sources/TileBackgroundCache.cpp \
+    $$PWD/../../Sources/WheelWidget.cpp \
+    main.cpp
+
+HEADERS += \
+    $$PWD/../../Headers/GP4k_GuiMapping.h \
+    $$PWD/../../Headers/GuiScale.h \
+    $$PWD/../../Headers/RasterAtlas.h \
+    $$PWD/../../Headers/TileBackgroundCache.h \
+    $$PWD/../../Headers/WheelWidget.h
@@ -0,0 +1,100 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QLabel>
+#include <QTextStream>
+#include <QTransform>
+
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
+#include "Headers/TileBackgroundCache.h"
+#include "Headers/WheelDelta.h"
+#include "Headers/WheelWidget.h"
+
+/**
+ * @brief Sets a tile background the way TileWidget did before the TileBackgroundCache: read and rotated at each call.
+ * @param Background The label displaying the background.
+ * @param File The path of the SVG.
+ * @param Angle The rotation of the tile.
+ */
+static void LoadBackgroundFromSvg(QLabel *Background, const QString &File, const int Angle){
+    QPixmap Pixmap(File);
+    if(Angle != 0){
+        QTransform RotationTransform;
+        RotationTransform.rotate(Angle);
+        Pixmap = Pixmap.transformed(RotationTransform);
+    }
+    Background->setPixmap(Pixmap);
+}
+
+int main(int argc, char *argv[])
+{
+    if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")){
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Measures the cost of a selection change on the inner tile group.");
+    Parser.addHelpOption();
+    const QCommandLineOption IterationsOption("iterations", "Selection changes to perform.", "count", "2000");
+    Parser.addOption(IterationsOption);
+    Parser.process(a);
+    const int Iterations = qMax(Parser.value(IterationsOption).toInt(), 1);
+
+    /* Before: a selection change reads two SVG, the previously selected tile
+     * and the newly selected one, and rotates them. Both cases are shown
+     * offscreen and painted after each change. */
+    const QVector<int> TileAngles{0, 0, 90, 90, 180, 180, 270, 270};
+    QWidget TileGroup;
+    QVector<QLabel*> Backgrounds;
+    for(uint8_t Index = 0; Index < NUMBER_OF_TILES; Index++){
+        const placement_t Placement = TileGroupsPlacements[INNER][Index];
+        Backgrounds.append(new QLabel(&TileGroup));
+        Backgrounds[Index]->setScaledContents(true);
+        Backgrounds[Index]->setGeometry(GuiScale::ToPixels(Placement));
+    }
+    const placement_t GroupPlacement = Placements["InnerTileGroup"];
+    TileGroup.resize(GuiScale::ToPixels(GroupPlacement).size());
+    TileGroup.show();
+    QApplication::processEvents();
+    QElapsedTimer Clock;
+    Clock.start();
+    for(int Iteration = 0; Iteration < Iterations; Iteration++){
+        const uint8_t Previous = Iteration % NUMBER_OF_TILES;
+        const uint8_t Selected = (Iteration + 1) % NUMBER_OF_TILES;
+        const QString Shape = (Previous % 2 == 0) ? "axes" : "diag";
+        const QString SelectedShape = (Selected % 2 == 0) ? "axes" : "diag";
+        LoadBackgroundFromSvg(Backgrounds[Previous], ":/Resources/tile_inner_" + Shape + ".svg", TileAngles[Previous]);
+        LoadBackgroundFromSvg(Backgrounds[Selected], ":/Resources/tile_inner_" + SelectedShape + "_selected.svg", TileAngles[Selected]);
+        QApplication::processEvents(); // Paints the invalidated labels
+    }
+    const qint64 SvgTime = Clock.nsecsElapsed();
+    TileGroup.hide();
+
+    // After: the same selection changes on the wheel, painting only the two changed tiles
+    WheelWidget Wheel;
+    Wheel.SetGeometryOnGrid(Placements["OuterTileGroup"]);
+    Wheel.show();
+    QApplication::processEvents();
+    const int RasterizationsBefore = TileBackgroundCache::GetRasterizationsCount();
+    Clock.restart();
+    WheelDelta Delta;
+    for(int Iteration = 0; Iteration < Iterations; Iteration++){
+        Delta.Clear();
+        Delta.SelectInnerTile((Iteration + 1) % NUMBER_OF_TILES);
+        Wheel.ApplyDelta(Delta);
+        QApplication::processEvents();
+    }
+    const qint64 WheelTime = Clock.nsecsElapsed();
+
+    QTextStream Out(stdout);
+    Out << "selection_changes: " << Iterations << "\n"
+        << "svg_ns_per_change: " << SvgTime / Iterations << "\n"
+        << "wheel_ns_per_change: " << WheelTime / Iterations << "\n"
+        << "speedup: " << static_cast<double>(SvgTime) / qMax(WheelTime, static_cast<qint64>(1)) << "\n"
+        << "rasterizations_during_changes: " << TileBackgroundCache::GetRasterizationsCount() - RasterizationsBefore << "\n"
+        << "rasterizations_total: " << TileBackgroundCache::GetRasterizationsCount() << "\n";
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+# Dictionary microbenchmarks: Trie insertion, search and suggestions, and the
+# Autocomplete typing sequences, on the bundled words list and synthetic ones.
+# Writes JSON measures and compares them to a baseline.
+
+QT -= gui
+QT += core concurrent
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-trie-benchmark
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    main.cpp
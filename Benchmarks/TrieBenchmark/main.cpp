@@ -0,0 +1,422 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPair>
+#include <QSaveFile>
+#include <QSet>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThreadPool>
+
+#include "Headers/Autocomplete.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/SwipeDecoder.h"
+#include "Headers/Trie.h"
+
+/**
+ * @def BENCHMARK_LETTERS
+ * @brief The letters of the synthetic words, from the most frequent in English to the least.
+ */
+#define BENCHMARK_LETTERS "etaoinshrdlcumwfgypbvkjxqz"
+
+/**
+ * @def BENCHMARK_BACKSPACES
+ * @brief The letters deleted at the end of each word typed through the Autocomplete.
+ */
+#define BENCHMARK_BACKSPACES 2
+
+/**
+ * @def BENCHMARK_FRAME_NS
+ * @brief The time of a frame at 60 Hz, within which a swipe must be decoded.
+ */
+#define BENCHMARK_FRAME_NS 16666667
+
+/**
+ * @brief The measures of a run, in the order they are printed. Those ending with _ns or _ms are times.
+ */
+typedef QVector<QPair<QString, double>> Metrics_t;
+
+/**
+ * @brief Builds distinct words of random letters and lengths.
+ * @param Count The number of words.
+ * @param Seed The seed of the letters and lengths.
+ * @param Excluded Words left out, such as those of a dictionary.
+ * @return The words.
+ */
+static QStringList SyntheticWords(const int Count, const quint64 Seed, const QSet<QString> &Excluded = QSet<QString>()){
+    std::mt19937_64 Generator(Seed);
+    // Zipf-like letters, and lengths around 7 as in a dictionary
+    std::vector<double> LetterWeights;
+    for(int Rank = 0; Rank < static_cast<int>(sizeof(BENCHMARK_LETTERS) - 1); Rank++){
+        LetterWeights.push_back(1.0 / (Rank + 2));
+    }
+    std::discrete_distribution<int> Letter(LetterWeights.begin(), LetterWeights.end());
+    std::binomial_distribution<int> Length(12, 0.45);
+
+    QSet<QString> Seen;
+    QStringList Words;
+    while(Words.length() < Count){
+        QString Word;
+        for(int Index = 0, Size = 2 + Length(Generator); Index < Size; Index++){
+            Word += QChar::fromLatin1(BENCHMARK_LETTERS[Letter(Generator)]);
+        }
+        if(!Seen.contains(Word) && !Excluded.contains(Word)){
+            Seen.insert(Word);
+            Words.append(Word);
+        }
+    }
+    return Words;
+}
+
+/**
+ * @brief Reads a words list.
+ * @param Path The file, a word per line.
+ * @return The words, in the order of the file.
+ */
+static QStringList ReadWords(const QString &Path){
+    QStringList Words;
+    QFile File(Path);
+    if(File.open(QIODevice::ReadOnly | QIODevice::Text)){
+        QTextStream Stream(&File);
+        Stream.setCodec("UTF-8");
+        QString Word;
+        while(Stream.readLineInto(&Word)){
+            Words.append(Word);
+        }
+    }
+    return Words;
+}
+
+/**
+ * @brief Writes a words list.
+ * @param Path The file to write.
+ * @param Words The words, a word per line.
+ * @return False if the file can't be written.
+ */
+static bool WriteWords(const QString &Path, const QStringList &Words){
+    QSaveFile File(Path);
+    if(!File.open(QIODevice::WriteOnly | QIODevice::Text)){
+        return false;
+    }
+    File.write(Words.join('\n').toUtf8());
+    return File.commit();
+}
+
+/**
+ * @brief Runs a measured pass several times.
+ * @param Repeats The number of passes.
+ * @param Operations The operations of a pass.
+ * @param Pass Runs the operations.
+ * @return The median of the passes, in nanoseconds per operation.
+ */
+static double MedianNs(const int Repeats, const int Operations, const std::function<void()> &Pass){
+    QVector<qint64> Times;
+    for(int Repeat = 0; Repeat < Repeats; Repeat++){
+        QElapsedTimer Clock;
+        Clock.start();
+        Pass();
+        Times.append(Clock.nsecsElapsed());
+    }
+    std::sort(Times.begin(), Times.end());
+    return static_cast<double>(Times[Times.length() / 2]) / qMax(Operations, 1);
+}
+
+/**
+ * @brief Picks random words of a list.
+ * @param Words The list.
+ * @param Count The words to pick.
+ * @param MinLength The shortest word picked.
+ * @param Seed The seed of the picks.
+ * @return The words, empty if none is long enough.
+ */
+static QStringList SampleWords(const QStringList &Words, const int Count, const int MinLength, const quint64 Seed){
+    QStringList Long;
+    for(const QString &Word : Words){
+        if(Word.length() >= MinLength){
+            Long.append(Word);
+        }
+    }
+    QStringList Sample;
+    std::mt19937_64 Generator(Seed);
+    while(!Long.isEmpty() && Sample.length() < Count){
+        Sample.append(Long[static_cast<int>(Generator() % static_cast<quint64>(Long.length()))]);
+    }
+    return Sample;
+}
+
+/**
+ * @brief Measures the Trie and the Autocomplete on a dictionary.
+ * @param Name The prefix of the metrics.
+ * @param Path The words list of the dictionary.
+ * @param Words The words of the list.
+ * @param Queries The operations of each measure.
+ * @param Repeats The passes of each measure, the median being kept.
+ * @param Metrics Receives the measures.
+ * @return False if the words list can't be loaded.
+ */
+static bool MeasureDictionary(const QString &Name, const QString &Path, const QStringList &Words, const int Queries,
+                              const int Repeats, Metrics_t &Metrics){
+    volatile int Sink = 0; // Keeps the results of the queries alive
+    QSharedPointer<Trie> Dictionary(new Trie(Path));
+    if(!Dictionary->IsLoaded()){ // An empty Trie would be measured as a very fast one
+        return false;
+    }
+
+    Metrics.append({Name + "_words", static_cast<double>(Words.length())});
+    Metrics.append({Name + "_load_ms", MedianNs(Repeats, 1, [&Path, &Sink](){
+        const Trie Loaded(Path);
+        Sink = Sink + (Loaded.GetRoot()->_Children.isEmpty() ? 0 : 1);
+    }) / 1e6});
+
+    const QStringList Hits = SampleWords(Words, Queries, 1, 1);
+    QStringList Misses;
+    for(const QString &Word : Hits){
+        Misses.append(Word + "qx");
+    }
+    Metrics.append({Name + "_search_hit_ns", MedianNs(Repeats, Hits.length(), [&Hits, &Dictionary, &Sink](){
+        for(const QString &Word : Hits){
+            Sink = Sink + (Dictionary->Search(Word) ? 1 : 0);
+        }
+    })});
+    Metrics.append({Name + "_search_miss_ns", MedianNs(Repeats, Misses.length(), [&Misses, &Dictionary, &Sink](){
+        for(const QString &Word : Misses){
+            Sink = Sink + (Dictionary->Search(Word) ? 1 : 0);
+        }
+    })});
+
+    // The prefixes of the words, with no letter to skip and with the letters of the first group, as when it's selected
+    const QVector<QPair<QString, CharGroup_t>> SkipSets = {
+        {"none", CharGroup_t()},
+        {"group", KeyboardLayout::Active().InnerChars(NOT_SHIFTED, 0)}
+    };
+    for(const int PrefixLength : {1, 2, 3, 5}){
+        QStringList Prefixes;
+        for(const QString &Word : SampleWords(Words, Queries, PrefixLength + 1, 2 + PrefixLength)){
+            Prefixes.append(Word.left(PrefixLength));
+        }
+        for(const QPair<QString, CharGroup_t> &Skip : SkipSets){
+            const CharGroup_t &SkipLastChar = Skip.second;
+            Metrics.append({QString("%1_suggest_p%2_%3_ns").arg(Name).arg(PrefixLength).arg(Skip.first),
+                            MedianNs(Repeats, Prefixes.length(), [&Prefixes, &SkipLastChar, &Dictionary, &Sink](){
+                for(const QString &Prefix : Prefixes){
+                    Sink = Sink + Dictionary->Suggest(Prefix, SkipLastChar).length();
+                }
+            })});
+        }
+    }
+
+    /* Typing words as the Controller does: the group of each letter is
+     * selected first, then the letter typed; the last letters are deleted
+     * and the word is accepted. Each call is timed on its own. */
+    const QStringList Typed = SampleWords(Words, Queries, BENCHMARK_BACKSPACES + 1, 3);
+    QVector<double> CharNs;
+    QVector<double> BackspaceNs;
+    QVector<double> SkipNs;
+    for(int Repeat = 0; Repeat < Repeats; Repeat++){
+        Autocomplete Completer(Dictionary);
+        qint64 Chars = 0;
+        qint64 CharTime = 0;
+        qint64 BackspaceTime = 0;
+        qint64 SkipTime = 0;
+        QElapsedTimer Clock;
+        Clock.start();
+        for(const QString &Word : Typed){
+            for(const QChar Letter : Word){
+                CharPosition_t Position = {0, 0, NOT_SHIFTED};
+                KeyboardLayout::Active().FindChar(Letter, Position);
+                qint64 Start = Clock.nsecsElapsed();
+                Completer.SetSkipLastChars(Position.Group);
+                SkipTime += Clock.nsecsElapsed() - Start;
+                Start = Clock.nsecsElapsed();
+                Completer.ChangeCharacter(Letter);
+                CharTime += Clock.nsecsElapsed() - Start;
+                Chars++;
+            }
+            const qint64 Start = Clock.nsecsElapsed();
+            for(int Backspace = 0; Backspace < BENCHMARK_BACKSPACES; Backspace++){
+                Completer.ChangeCharacter("");
+            }
+            BackspaceTime += Clock.nsecsElapsed() - Start;
+            Completer.ClearBuffer();
+        }
+        QThreadPool::globalInstance()->waitForDone(); // The prefetches of the last word
+        CharNs.append(static_cast<double>(CharTime) / qMax<qint64>(Chars, 1));
+        SkipNs.append(static_cast<double>(SkipTime) / qMax<qint64>(Chars, 1));
+        BackspaceNs.append(static_cast<double>(BackspaceTime) / qMax(Typed.length() * BENCHMARK_BACKSPACES, 1));
+    }
+    for(QVector<double> *Times : {&CharNs, &BackspaceNs, &SkipNs}){
+        std::sort(Times->begin(), Times->end());
+    }
+    Metrics.append({Name + "_autocomplete_char_ns", CharNs[Repeats / 2]});
+    Metrics.append({Name + "_autocomplete_backspace_ns", BackspaceNs[Repeats / 2]});
+    Metrics.append({Name + "_autocomplete_skip_ns", SkipNs[Repeats / 2]});
+
+    /* Swiping words: the path is the tiles of the letters, a double letter
+     * being a single visit. The words with a char on no tile can't be
+     * swiped. The slowest decoding must fit in a frame. */
+    QVector<QVector<SwipeKey_t>> Paths;
+    for(const QString &Word : SampleWords(Words, Queries, 3, 6)){
+        QVector<SwipeKey_t> Path;
+        bool OnTiles = true;
+        for(const QChar Letter : Word){
+            CharPosition_t Position = {0, 0, NOT_SHIFTED};
+            OnTiles = OnTiles && KeyboardLayout::Active().FindChar(Letter, Position);
+            const SwipeKey_t Key = {Position.Group, Position.Tile};
+            if(Path.isEmpty() || !(Path.last() == Key)){
+                Path.append(Key);
+            }
+        }
+        if(OnTiles){
+            Paths.append(Path);
+        }
+    }
+    const SwipeDecoder Decoder(Dictionary);
+    qint64 SlowestDecode = 0;
+    int OverFrame = 0;
+    Metrics.append({Name + "_swipe_decode_ns", MedianNs(Repeats, Paths.length(), [&Paths, &Decoder, &SlowestDecode, &OverFrame, &Sink](){
+        QElapsedTimer Clock;
+        int PassOverFrame = 0;
+        for(const QVector<SwipeKey_t> &Path : Paths){
+            Clock.start();
+            Sink = Sink + Decoder.Decode(Path).length();
+            const qint64 Time = Clock.nsecsElapsed();
+            SlowestDecode = qMax(SlowestDecode, Time);
+            PassOverFrame += (Time > BENCHMARK_FRAME_NS) ? 1 : 0;
+        }
+        OverFrame = qMax(OverFrame, PassOverFrame);
+    })});
+    Metrics.append({Name + "_swipe_decode_max_ms", SlowestDecode / 1e6});
+    Metrics.append({Name + "_swipe_over_frame", static_cast<double>(OverFrame)});
+
+    // Last, as they grow the dictionary: the new words are measured in a single pass, a word being inserted once
+    Metrics.append({Name + "_search_and_insert_hit_ns", MedianNs(Repeats, Hits.length(), [&Hits, &Dictionary, &Sink](){
+        for(const QString &Word : Hits){
+            Sink = Sink + (Dictionary->SearchAndInsert(Word) ? 1 : 0);
+        }
+    })});
+    const QSet<QString> Known(Words.begin(), Words.end());
+    const QStringList NewWords = SyntheticWords(Queries, 4, Known);
+    Metrics.append({Name + "_search_and_insert_new_ns", MedianNs(1, NewWords.length(), [&NewWords, &Dictionary, &Sink](){
+        for(const QString &Word : NewWords){
+            Sink = Sink + (Dictionary->SearchAndInsert(Word) ? 1 : 0);
+        }
+    })});
+    const QStringList InsertedWords = SyntheticWords(Queries, 5, Known);
+    Metrics.append({Name + "_insert_ns", MedianNs(1, InsertedWords.length(), [&InsertedWords, &Dictionary](){
+        for(const QString &Word : InsertedWords){
+            Dictionary->Insert(Word);
+        }
+    })});
+}
+
+/**
+ * @brief Compares times to a baseline.
+ * @param Metrics The measures of the run.
+ * @param Baseline The measures of a previous run, as written by --json.
+ * @param Threshold The relative slowdown tolerated, such as 0.15.
+ * @param Out The stream to print the regressions to.
+ * @return The number of times slower than the baseline beyond the threshold.
+ */
+static int CompareToBaseline(const Metrics_t &Metrics, const QJsonObject &Baseline, const double Threshold, QTextStream &Out){
+    int Regressions = 0;
+    for(const QPair<QString, double> &Metric : Metrics){
+        const bool IsTime = Metric.first.endsWith("_ns") || Metric.first.endsWith("_ms");
+        const double Reference = Baseline.value(Metric.first).toDouble(0.0);
+        if(!IsTime || Reference <= 0.0){ // A count, or a measure the baseline doesn't have
+            continue;
+        }
+        const double Ratio = Metric.second / Reference;
+        if(Ratio > 1.0 + Threshold){
+            Out << "regression: " << Metric.first << " | baseline " << Reference << " | now " << Metric.second
+                << " | ratio " << Ratio << "\n";
+            Regressions++;
+        }
+    }
+    return Regressions;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Measures the Trie and the Autocomplete on the bundled words list and on synthetic ones.");
+    Parser.addHelpOption();
+    const QCommandLineOption SizesOption("sizes", "Sizes of the synthetic words lists, comma separated.", "words", "100000,200000,1000000");
+    const QCommandLineOption QueriesOption("queries", "Operations of each measure.", "count", "5000");
+    const QCommandLineOption RepeatsOption("repeats", "Passes of each measure, the median being kept.", "count", "5");
+    const QCommandLineOption JsonOption("json", "Write the measures to <file>, as a JSON object.", "file");
+    const QCommandLineOption BaselineOption("baseline", "Compare the times to those of a previous --json <file>, and "
+                                            "exit with 1 if one is slower beyond the threshold.", "file");
+    const QCommandLineOption ThresholdOption("threshold", "Relative slowdown tolerated by --baseline.", "ratio", "0.15");
+    Parser.addOptions({SizesOption, QueriesOption, RepeatsOption, JsonOption, BaselineOption, ThresholdOption});
+    Parser.process(a);
+    const int Queries = qMax(Parser.value(QueriesOption).toInt(), 1);
+    const int Repeats = qMax(Parser.value(RepeatsOption).toInt(), 1);
+
+    QTemporaryDir Directory;
+    if(!Directory.isValid()){
+        qCritical() << "Cannot create a temporary directory for the synthetic words lists";
+        return 2;
+    }
+
+    Metrics_t Metrics;
+    const QString BundledPath = ":/Resources/trie_word_list.txt";
+    if(!MeasureDictionary("bundled", BundledPath, ReadWords(BundledPath), Queries, Repeats, Metrics)){
+        return 2;
+    }
+    for(const QString &Size : Parser.value(SizesOption).split(',', Qt::SkipEmptyParts)){
+        const int Count = Size.toInt();
+        if(Count <= 0){
+            continue;
+        }
+        const QString Name = (Count % 1000000 == 0) ? QString("synthetic_%1m").arg(Count / 1000000)
+                           : (Count % 1000 == 0)    ? QString("synthetic_%1k").arg(Count / 1000)
+                                                    : QString("synthetic_%1").arg(Count);
+        const QString Path = Directory.filePath(Name + ".txt");
+        const QStringList Words = SyntheticWords(Count, static_cast<quint64>(Count));
+        if(!WriteWords(Path, Words)){
+            qCritical() << "Cannot write" << Path;
+            return 2;
+        }
+        if(!MeasureDictionary(Name, Path, Words, Queries, Repeats, Metrics)){
+            return 2;
+        }
+    }
+
+    QTextStream Out(stdout);
+    QJsonObject Results;
+    for(const QPair<QString, double> &Metric : Metrics){
+        Out << Metric.first << ": " << Metric.second << "\n";
+        Results.insert(Metric.first, Metric.second);
+    }
+
+    if(Parser.isSet(JsonOption)){
+        QSaveFile File(Parser.value(JsonOption));
+        if(!File.open(QIODevice::WriteOnly) || File.write(QJsonDocument(Results).toJson()) < 0 || !File.commit()){
+            qCritical() << "Cannot write" << Parser.value(JsonOption);
+            return 2;
+        }
+    }
+
+    if(Parser.isSet(BaselineOption)){
+        QFile File(Parser.value(BaselineOption));
+        if(!File.open(QIODevice::ReadOnly)){
+            qCritical() << "Cannot open" << Parser.value(BaselineOption);
+            return 2;
+        }
+        const QJsonObject Baseline = QJsonDocument::fromJson(File.readAll()).object();
+        const int Regressions = CompareToBaseline(Metrics, Baseline, Parser.value(ThresholdOption).toDouble(), Out);
+        Out << "regressions: " << Regressions << "\n";
+        return (Regressions > 0) ? 1 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+# gp4k-core: the headless engine linked by the GP4k application, the tools in
+# Tools/ and the benchmarks in Benchmarks/, see GP4k_Engine.pri. The Controller
+# state machine, the keyboard layout, the autocomplete and the dictionary, with
+# no widget nor gamepad: the inputs come from an InputSource, the outputs are
+# the Controller signals.
+
+TEMPLATE = lib
+CONFIG += staticlib c++17
+
+QT -= gui
+QT += core concurrent
+
+TARGET = gp4k-core
+
+# Tracing, compiled out by default: qmake "GP4K_TRACE_LEVEL=2", see Headers/Trace.h
+!isEmpty(GP4K_TRACE_LEVEL): DEFINES += GP4K_TRACE_LEVEL=$$GP4K_TRACE_LEVEL
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    $$PWD/../Sources/Autocomplete.cpp \
+    $$PWD/../Sources/Controller.cpp \
+    $$PWD/../Sources/InputRecorder.cpp \
+    $$PWD/../Sources/KeyboardLayout.cpp \
+    $$PWD/../Sources/LayoutWatcher.cpp \
+    $$PWD/../Sources/StickStateMachine.cpp \
+    $$PWD/../Sources/SwipeDecoder.cpp \
+    $$PWD/../Sources/TextBuffer.cpp \
+    $$PWD/../Sources/Trace.cpp \
+    $$PWD/../Sources/Trie.cpp \
+    $$PWD/../Sources/TypingStats.cpp \
+    $$PWD/../Sources/WheelDelta.cpp \
+    $$PWD/../Sources/WheelViewModel.cpp
+
+HEADERS += \
+    $$PWD/../Headers/Autocomplete.h \
+    $$PWD/../Headers/CharIndex.h \
+    $$PWD/../Headers/Controller.h \
+    $$PWD/../Headers/GP4k_ButtonsMapping.h \
+    $$PWD/../Headers/GP4k_TilesMapping.h \
+    $$PWD/../Headers/GP4k_Typedefs.h \
+    $$PWD/../Headers/InputRecorder.h \
+    $$PWD/../Headers/InputSource.h \
+    $$PWD/../Headers/KeyboardLayout.h \
+    $$PWD/../Headers/LayoutWatcher.h \
+    $$PWD/../Headers/StickStateMachine.h \
+    $$PWD/../Headers/SwipeDecoder.h \
+    $$PWD/../Headers/TextBuffer.h \
+    $$PWD/../Headers/Trace.h \
+    $$PWD/../Headers/Trie.h \
+    $$PWD/../Headers/TypingStats.h \
+    $$PWD/../Headers/WheelDelta.h \
+    $$PWD/../Headers/WheelViewModel.h
@@ -1,46 +1,35 @@
-QT       += \
-    core gui \
-    gamepad
+# Builds the gp4k-core library, then the GP4k application, the tools and the
+# benchmarks, which all link the same engine, see GP4k_Engine.pri.
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+TEMPLATE = subdirs
 
-CONFIG += \ c++17
+SUBDIRS += \
+    Core \
+    App \
+    GuiThroughputBenchmark \
+    LayoutCompiler \
+    LayoutOptimizer \
+    NgramCounter \
+    TextFieldBenchmark \
+    TileBackgroundBenchmark \
+    TrieBenchmark \
+    TypingSimulator
 
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+Core.file = Core/Core.pro
+App.file = App/App.pro
+GuiThroughputBenchmark.file = Benchmarks/GuiThroughputBenchmark/GuiThroughputBenchmark.pro
+LayoutCompiler.file = Tools/LayoutCompiler/LayoutCompiler.pro
+LayoutOptimizer.file = Tools/LayoutOptimizer/LayoutOptimizer.pro
+NgramCounter.file = Tools/NgramCounter/NgramCounter.pro
+TextFieldBenchmark.file = Benchmarks/TextFieldBenchmark/TextFieldBenchmark.pro
+TileBackgroundBenchmark.file = Benchmarks/TileBackgroundBenchmark/TileBackgroundBenchmark.pro
+TrieBenchmark.file = Benchmarks/TrieBenchmark/TrieBenchmark.pro
+TypingSimulator.file = Tools/TypingSimulator/TypingSimulator.pro
 
-SOURCES += \
-    Sources/Autocomplete.cpp \
-    Sources/GuideWidget.cpp \
-    Sources/Controller.cpp \
-    Sources/ImageWidget.cpp \
-    Sources/TextFieldWidget.cpp \
-    Sources/TileGroupWidget.cpp \
-    Sources/TileWidget.cpp \
-    Sources/Trie.cpp \
-    Sources/main.cpp \
-    Sources/mainwindow.cpp
-
-HEADERS += \
-    Headers/GP4k_ButtonsMapping.h \
-    Headers/Autocomplete.h \
-    Headers/Controller.h \
-    Headers/GP4k_GuiMapping.h \
-    Headers/GP4k_TilesMapping.h \
-    Headers/GP4k_Typedefs.h \
-    Headers/GuideWidget.h \
-    Headers/ImageWidget.h \
-    Headers/TextFieldWidget.h \
-    Headers/TileGroupWidget.h \
-    Headers/TileWidget.h \
-    Headers/Trie.h \
-    Headers/mainwindow.h
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
-
-RESOURCES += \
-    Resources.qrc
+App.depends = Core
+GuiThroughputBenchmark.depends = Core
+LayoutCompiler.depends = Core
+LayoutOptimizer.depends = Core
+TileBackgroundBenchmark.depends = Core
+TrieBenchmark.depends = Core
+TypingSimulator.depends = Core
@@ -0,0 +1,24 @@
+# Links the gp4k-core static library, built by Core/Core.pro, into the GP4k
+# application and the tools: the Controller state machine, the keyboard layout,
+# the autocomplete and the dictionary. Build them through GP4k.pro, which builds
+# the library first.
+
+QT += concurrent
+
+# Tracing, compiled out by default: qmake "GP4K_TRACE_LEVEL=2", see Headers/Trace.h
+!isEmpty(GP4K_TRACE_LEVEL): DEFINES += GP4K_TRACE_LEVEL=$$GP4K_TRACE_LEVEL
+
+INCLUDEPATH += $$PWD
+
+GP4K_CORE_DIR = $$shadowed($$PWD)/Core
+win32:CONFIG(release, debug|release): GP4K_CORE_DIR = $$GP4K_CORE_DIR/release
+else:win32:CONFIG(debug, debug|release): GP4K_CORE_DIR = $$GP4K_CORE_DIR/debug
+
+LIBS += -L$$GP4K_CORE_DIR -lgp4k-core
+win32-msvc*: PRE_TARGETDEPS += $$GP4K_CORE_DIR/gp4k-core.lib
+else: PRE_TARGETDEPS += $$GP4K_CORE_DIR/libgp4k-core.a
+
+# The resources of a static library are not registered without Q_INIT_RESOURCE:
+# the executables compile them, the words list of the dictionary included.
+RESOURCES += \
+    $$PWD/Resources.qrc
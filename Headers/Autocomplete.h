@@ -3,6 +3,10 @@
 #ifndef AUTOCOMPLETE_H
 #define AUTOCOMPLETE_H
 
+#include <QFuture>
+#include <QHash>
+#include <QPair>
+
 #include "Headers/Trie.h"
 
 /**
@@ -14,16 +18,52 @@ enum actions_t {
     NOTHING
 };
 
+/**
+ * @brief Counts the work done by the suggestions prefetching.
+ */
+struct PrefetchStats_t {
+    quint64 Launched;   /**< Suggestion lists computed in the background. */
+    quint64 Hits;       /**< Buffers which suggestions were ready when needed. */
+    quint64 LateHits;   /**< Buffers which suggestions were still being computed when needed. */
+    quint64 Misses;     /**< Buffers which suggestions were not prefetched, and were computed on the input path. */
+    quint64 Wasted;     /**< Prefetched lists discarded without being used. */
+    quint64 Deferred;   /**< Queries made before the dictionary was loaded, answered once it was. */
+    qint64 SeekTime;    /**< Nanoseconds spent obtaining suggestions on the input path. */
+};
+
 /**
  * @brief The Autocomplete class is the interface between the controller and a trie
  * It's meant to simplify reading of the controller class source file.
+ *
+ * @details Once a char group is selected, the next character is one of the chars of this group. The suggestions for
+ * the buffer extended by each of them are computed in the background, so typing a character only swaps in a ready
+ * list. The suggestions of the buffer itself are also computed with the chars to skip of each other group showing
+ * suggestions, so selecting another group swaps in a ready list too.
+ *
+ * The Autocomplete suggests nothing until it gets its dictionary, which is loaded in the background at startup.
+ *
+ * The Trie is shared and read-only: each Autocomplete only owns its buffer, cursor, suggestions and prefetched lists,
+ * so several sessions can type at once without locking each other.
  */
 class Autocomplete{
 public: // Methods
     /**
      * @brief Constructor of the Autocomplete.
+     * @param Dictionary The Trie to query, shared with the other sessions. Null if not loaded yet.
      */
-    Autocomplete();
+    explicit Autocomplete(const QSharedPointer<const Trie> &Dictionary = QSharedPointer<const Trie>());
+
+    /**
+     * @brief Setter for the dictionary, once loaded. The suggestions of the current buffer are sought at once.
+     * @param Dictionary The Trie to query, shared with the other sessions.
+     */
+    void SetDictionary(const QSharedPointer<const Trie> &Dictionary);
+
+    /**
+     * @brief Tells if the dictionary is loaded.
+     * @return True if the Autocomplete has a dictionary, false else.
+     */
+    bool HasDictionary(void) const;
 
     /**
      * @brief Change a character in the buffer at the position described by the the buffer info.
@@ -50,6 +90,12 @@ public: // Methods
      */
     QVector<QString> GetSuggestions(void) const;
 
+    /**
+     * @brief Getter for the buffer.
+     * @return The word being typed, in lower case.
+     */
+    QString GetBuffer(void) const;
+
     /**
      * @brief Getter for the index of the buffer's cursor.
      * @return The position of the buffer's cursor.
@@ -58,21 +104,53 @@ public: // Methods
 
     /**
      * @brief Setter for the SkipLastChars.
-     * @param the index of the char group in InnerTilesChars.
+     * @param the index of the char group in the active KeyboardLayout.
      */
     void SetSkipLastChars(const uint8_t CharGroupIndex);
 
+    /**
+     * @brief Setter for the selected char group: the group the next character will be typed from.
+     * @param CharGroupIndex the index of the char group in the active KeyboardLayout.
+     * @details Also sets the SkipLastChars when the group has suggestion tiles.
+     */
+    void SetCharGroup(const uint8_t CharGroupIndex);
+
+    /**
+     * @brief Getter for the prefetching counters.
+     * @return The counters since the construction.
+     */
+    PrefetchStats_t GetPrefetchStats(void) const;
+
 private: // Methods
     /**
      * @brief Seek for new Suggestions.
      */
     void SeekSuggestions(void);
 
+    /**
+     * @brief Starts computing, in the background, the suggestions for the buffer extended by each char of the group.
+     */
+    void Prefetch(void);
+
+    /**
+     * @brief Forgets the prefetched suggestions, that can't be used anymore.
+     */
+    void DiscardPrefetches(void);
+
+    /**
+     * @brief Starts computing a suggestion list in the background, or keeps the one already started.
+     * @param Candidate The buffer to seek the suggestions of.
+     * @param SkipLastChars The chars to avoid as a last character.
+     * @param Previous The prefetches of the previous input, the still wanted ones are taken from it.
+     */
+    void PrefetchOne(const QString &Candidate, const CharGroup_t &SkipLastChars,
+                     QHash<QPair<QString, CharGroup_t>, QFuture<QVector<QString>>> &Previous);
+
 private: // Attributes
     /**
-     * @brief The Trie of autocomplete feature.
+     * @brief The Trie of autocomplete feature, shared with the other sessions. Null until loaded.
      */
-    Trie* _Trie;
+    QSharedPointer<const Trie> _Trie;
 
     /**
      * @def _BufferInfo
@@ -97,6 +175,21 @@ private: // Attributes
      * @brief The chars to avoid as a last character.
      */
     CharGroup_t _SkipLastChars;
+
+    /**
+     * @brief The selected char group.
+     */
+    uint8_t _CharGroup;
+
+    /**
+     * @brief The suggestions being computed in the background, indexed by their buffer and chars to skip.
+     */
+    QHash<QPair<QString, CharGroup_t>, QFuture<QVector<QString>>> _Prefetches;
+
+    /**
+     * @brief The prefetching counters.
+     */
+    PrefetchStats_t _PrefetchStats;
 };
 
 #endif // AUTOCOMPLETE_H
@@ -0,0 +1,272 @@
+/* CharIndex.h */
+
+#ifndef CHARINDEX_H
+#define CHARINDEX_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @def CHAR_INDEX_CAPACITY
+ * @brief The characters a CharIndex can hold: one per inner tile, in both shift states.
+ */
+#define CHAR_INDEX_CAPACITY (2U * NUMBER_OF_TILES * NUMBER_OF_TILES)
+
+/**
+ * @def CHAR_INDEX_ASCII
+ * @brief The code points found by a direct lookup, the other ones by a binary search.
+ */
+#define CHAR_INDEX_ASCII 128U
+
+/**
+ * @def NO_CODE_POINT
+ * @brief Returned by Utf8CodePoint for a text that is not a single character.
+ */
+#define NO_CODE_POINT 0xFFFFFFFFU
+
+/**
+ * @def LAYOUT_REQUIRED_CHARS
+ * @brief The characters every layout must place on a tile.
+ */
+#define LAYOUT_REQUIRED_CHARS "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+
+/**
+ * @brief A character of a layout, and the tile typing it.
+ */
+struct CharIndexEntry_t {
+    char32_t CodePoint;      /**< The character. */
+    CharPosition_t Position; /**< The tile typing it. */
+};
+
+/**
+ * @brief Decodes the text of a tile.
+ * @param Text A UTF-8 text.
+ * @return Its code point if it's exactly one well-formed character, NO_CODE_POINT else: emotes followed by a
+ * variation selector, as "☺️", are two code points and can't be found in a text read char by char.
+ */
+constexpr char32_t Utf8CodePoint(const std::string_view &Text){
+    if(Text.empty()){
+        return NO_CODE_POINT;
+    }
+    const uint8_t Lead = static_cast<uint8_t>(Text[0]);
+    const size_t Length = (Lead < 0x80) ? 1 : ((Lead >> 5) == 0x6) ? 2 : ((Lead >> 4) == 0xE) ? 3 : ((Lead >> 3) == 0x1E) ? 4 : 0;
+    if(Length == 0 || Text.size() != Length){
+        return NO_CODE_POINT;
+    }
+    char32_t CodePoint = (Length == 1) ? Lead : (Lead & (0x7F >> Length));
+    for(size_t Index = 1; Index < Length; Index++){
+        const uint8_t Continuation = static_cast<uint8_t>(Text[Index]);
+        if((Continuation >> 6) != 0x2){
+            return NO_CODE_POINT;
+        }
+        CodePoint = (CodePoint << 6) | (Continuation & 0x3F);
+    }
+    return CodePoint;
+}
+
+/**
+ * @brief The CharIndex class finds the tile typing a character without hashing nor allocating.
+ *
+ * @details The entries are sorted by code point, and the ASCII ones are also reached through a direct table: the
+ * letters, digits and most of the symbols of a text are found with a single array access, the others with a binary
+ * search on at most CHAR_INDEX_CAPACITY entries. A literal type, so the index of the built-in layout is computed by
+ * the compiler (see BuiltinCharIndex); the index of a layout file is built with the same Insert when it's loaded.
+ *
+ * A character on several tiles keeps the first one inserted: FromTiles inserts the NOT_SHIFTED tiles first.
+ */
+class CharIndex {
+public: // Methods
+    /**
+     * @brief Constructor of an empty CharIndex.
+     */
+    constexpr CharIndex() : _Entries{}, _Ascii{}, _Count(0) {}
+
+    /**
+     * @brief Builds the index of tiles tables.
+     * @param Tiles The UTF-8 texts of the tiles, as InnerTilesChars.
+     * @return The index of every tile holding a single character.
+     */
+    static constexpr CharIndex FromTiles(const TilesTable_t &Tiles){
+        CharIndex Index;
+        for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+            for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+                for(uint8_t Tile = 0; Tile < NUMBER_OF_TILES; Tile++){
+                    Index.Insert(Utf8CodePoint(Tiles[Shift][Group][Tile]), {Group, Tile, Shift});
+                }
+            }
+        }
+        return Index;
+    }
+
+    /**
+     * @brief Adds a character.
+     * @param CodePoint The character.
+     * @param Position The tile typing it.
+     * @return False if the character is NO_CODE_POINT or already indexed, the index being unchanged.
+     */
+    constexpr bool Insert(const char32_t CodePoint, const CharPosition_t Position){
+        if(CodePoint == NO_CODE_POINT || Find(CodePoint) != nullptr || _Count == static_cast<int>(CHAR_INDEX_CAPACITY)){
+            return false;
+        }
+        int Index = _Count;
+        for(; Index > 0 && _Entries[Index - 1].CodePoint > CodePoint; Index--){
+            _Entries[Index] = _Entries[Index - 1];
+        }
+        _Entries[Index] = {CodePoint, Position};
+        _Count++;
+        for(uint8_t &Slot : _Ascii){ // The entries after the new one moved by one
+            Slot += (Slot > Index) ? 1 : 0;
+        }
+        if(CodePoint < CHAR_INDEX_ASCII){
+            _Ascii[CodePoint] = static_cast<uint8_t>(Index + 1);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Finds the tile typing a character.
+     * @param CodePoint The character.
+     * @return Its entry, nullptr if no tile types it.
+     */
+    constexpr const CharIndexEntry_t* Find(const char32_t CodePoint) const{
+        if(CodePoint < CHAR_INDEX_ASCII){
+            return (_Ascii[CodePoint] == 0) ? nullptr : &_Entries[_Ascii[CodePoint] - 1];
+        }
+        int Low = 0;
+        int High = _Count;
+        while(Low < High){
+            const int Middle = (Low + High) / 2;
+            if(_Entries[Middle].CodePoint < CodePoint){
+                Low = Middle + 1;
+            }else{
+                High = Middle;
+            }
+        }
+        return (Low < _Count && _Entries[Low].CodePoint == CodePoint) ? &_Entries[Low] : nullptr;
+    }
+
+    /**
+     * @brief Getter for the number of characters.
+     * @return The entries of the index.
+     */
+    constexpr int Size(void) const { return _Count; }
+
+    /**
+     * @brief Iterators over the entries, by increasing code point.
+     */
+    constexpr const CharIndexEntry_t* begin(void) const { return _Entries.data(); }
+    constexpr const CharIndexEntry_t* end(void) const { return _Entries.data() + _Count; }
+
+private: // Attributes
+    /**
+     * @brief The characters and their tiles, sorted by code point. Only the _Count first ones are used.
+     */
+    std::array<CharIndexEntry_t, CHAR_INDEX_CAPACITY> _Entries;
+
+    /**
+     * @brief The entry of each ASCII character, plus one. 0 for the characters on no tile.
+     */
+    std::array<uint8_t, CHAR_INDEX_ASCII> _Ascii;
+
+    /**
+     * @brief The number of entries.
+     */
+    int _Count;
+};
+
+/* The checks of the built-in tables, run by the static_assert of
+ * GP4k_TilesMapping.h. A layout file gets the same checks when loaded,
+ * see KeyboardLayout. */
+
+/**
+ * @brief Checks each group fills its tiles next to its suggestions, without gaps.
+ * @param Tiles The UTF-8 texts of the tiles.
+ * @param Suggestions The number of suggestion tiles of each group.
+ * @return True if every group has NUMBER_OF_TILES - Suggestions chars, on its first tiles, in both shift states.
+ */
+constexpr bool GroupsFitTiles(const TilesTable_t &Tiles, const uint8_t (&Suggestions)[NUMBER_OF_TILES]){
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+            for(uint8_t Tile = 0; Tile < NUMBER_OF_TILES; Tile++){
+                if(Tiles[Shift][Group][Tile].empty() != (Tile >= NUMBER_OF_TILES - Suggestions[Group])){
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compares two texts without copying them.
+ * @details GCC rejects, in a constant expression, the copy of a string view the table left to its default value, as
+ * the tiles next to the suggestions: the checks only read the tiles through references.
+ * @param Text A text.
+ * @param Other Another text.
+ * @return True if both have the same bytes.
+ */
+constexpr bool SameText(const std::string_view &Text, const std::string_view &Other){
+    if(Text.size() != Other.size()){
+        return false;
+    }
+    for(size_t Index = 0; Index < Text.size(); Index++){
+        if(Text[Index] != Other[Index]){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks no text is on two tiles. The same tile may have the same text in both shift states, as the emotes.
+ * @param Tiles The UTF-8 texts of the tiles.
+ * @return True if no text is on two tiles.
+ */
+constexpr bool HasNoDuplicateChar(const TilesTable_t &Tiles){
+    constexpr uint32_t GroupTiles = NUMBER_OF_TILES * NUMBER_OF_TILES;
+    auto Text = [&Tiles](const uint32_t Tile) -> const std::string_view& { return Tiles[Tile / GroupTiles][(Tile / NUMBER_OF_TILES) % NUMBER_OF_TILES][Tile % NUMBER_OF_TILES]; };
+    for(uint32_t Tile = 0; Tile < 2 * GroupTiles; Tile++){
+        for(uint32_t Other = Tile + 1; Other < 2 * GroupTiles && !Text(Tile).empty(); Other++){
+            if(Other % GroupTiles != Tile % GroupTiles && SameText(Text(Other), Text(Tile))){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks characters are on tiles.
+ * @param Index The index of the tiles.
+ * @param Required The characters, ASCII only.
+ * @return True if each of them is on a tile.
+ */
+constexpr bool HasChars(const CharIndex &Index, const std::string_view Required){
+    for(const char Character : Required){
+        if(Index.Find(static_cast<char32_t>(Character)) == nullptr){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks every outer tile has a text.
+ * @param Outer The UTF-8 texts of the outer tiles.
+ * @return True if no text is empty.
+ */
+constexpr bool HasOuterTexts(const OuterTable_t &Outer){
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        for(uint8_t Tile = 0; Tile < NUMBER_OF_TILES; Tile++){
+            if(Outer[Shift][Tile].empty()){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#endif // CHARINDEX_H
@@ -3,15 +3,27 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
-#include <QtGamepad/QGamepad>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QScopedPointer>
 #include <QVector>
-#include <QWidget>
-#include <QTextEdit>
-#include <QMap>
 
 #include "Headers/Autocomplete.h"
 #include "Headers/GP4k_ButtonsMapping.h"
 #include "Headers/GP4k_Typedefs.h"
+#include "Headers/InputRecorder.h"
+#include "Headers/InputSource.h"
+#include "Headers/StickStateMachine.h"
+#include "Headers/SwipeDecoder.h"
+#include "Headers/WheelDelta.h"
+#include "Headers/WheelViewModel.h"
+
+/**
+ * @def SWIPE_TRIGGER_THRESHOLD
+ * @brief The value from which the analog swipe trigger starts a swipe. The swipe ends when it's fully released.
+ */
+#define SWIPE_TRIGGER_THRESHOLD 0.5
 
 /**
  * @brief Represents the joysticks on the gamepad.
@@ -21,14 +33,6 @@ enum stick_t {
     STICK_RIGHT
 };
 
-/**
- * @brief describe if a stick is at the border or not.
- */
-enum StickPosition_t : uint8_t{
-    CENTER = 0,
-    BORDER = 1
-};
-
 /**
  * @brief Represents the axes of a joystick.
  */
@@ -39,79 +43,85 @@ enum axis_t { X_AXIS, Y_AXIS };
  *
  * This class is responsible for handling input from a gamepad, tracking joystick positions,
  * calculating angles and tile selections, and updating elements on the GUI.
+ *
+ * @details It's part of the headless gp4k-core library: the inputs come from InputSources, or from HandleInput
+ * directly, and its signals are the output, whether a widget, a TextBuffer or any other frontend receives them.
  */
-class Controller : public QWidget
+class Controller : public QObject
 {
     Q_OBJECT
 
 signals:
     /**
-     * @brief Signal emitted to set the background of an outer tile.
-     * @param Tile The index of the tile in its group.
+     * @brief Signal emitted once per handled event that changed the wheel.
+     * @param Delta All the changes of the tile groups caused by the event, to apply in a single pass. Only the
+     * changes the wheel doesn't display yet, see WheelViewModel.
      */
-    void ToggleOuterSelectedTile(uint8_t Tile);
+    void UpdateWheel(const WheelDelta &Delta);
 
     /**
-     * @brief Signal emitted to set the background of an inner tile.
-     * @param Tile The index of the tile in its group.
-     */
-    void ToggleInnerSelectedTile(uint8_t Tile);
-
-    /**
-     * @brief Signal emitted to
-     * @param Index The Index of the character set to switch to for the right TileGroup.
-     * @param Caps The offset to use caps or not.
+     * @brief Signal emitted to type a character in the text field.
+     * @param Text The character to type.
      */
+    void TypeToTextField(QString Text);
 
     /**
-     * @brief Signal emitted to change the characters of the inner tile group.
-     * @param ShiftKey the state of the shift key.
-     * @param CharGroup Index of the selected char group.
+     * @brief Signal emitted for each char the user typed on a tile or a button, one at a time.
+     * @param Text The char typed.
+     *
+     * @details Unlike TypeToTextField, never emitted for the accepted suggestions nor the swiped words: the chars the
+     * user did not type themselves are not counted in the typing statistics.
      */
-    void UpdateInnerTiles(ShiftState_t ShiftKey, uint8_t CharGroup);
+    void CharTyped(QString Text);
 
     /**
-     * @brief Signal emitted to change the suggestions tiles status.
-     * @param TileIndex The index of the suggestion tile.
-     * @param Suggestion The suggestion to display, or "" if no suggestion.
+     * @brief Signal emitted to send special instructions to the text field, such as moving the cursor.
+     * @param Key The key associated to this instruction.
      */
-    void UpdateSuggestionTile(uint8_t TileIndex, QString Suggestion);
+    void SendOrderToTextField(Qt::Key Key);
 
     /**
-     * @brief Signal emitted to make all the tiles of inner group available and unselected.
+     * @brief Signal emitted at the end of an event that typed or sent orders to the text field, so its edits can be
+     * applied as a single block.
      */
-    void ResetCenterBackgrounds(void);
+    void TextEditsEnded(void);
 
     /**
-     * @brief Signal emitted to type a character in the text field.
-     * @param Text The character to type.
+     * @brief Signal emitted to switch the texts of the guides depending on the shift state.
+     * @param ShiftKey the state of the Shift Key.
+     * @param CharGroup the current char group.
+     *
+     * @details Only emitted when the shift state actually changed. The tiles texts are switched by the UpdateWheel
+     * of the same event.
      */
-    void TypeToTextField(QString Text);
+    void ToggleTextsOnShift(ShiftState_t ShiftKey, uint8_t CharGroup);
 
     /**
-     * @brief Signal emitted to send special instructions to the text field, such as moving the cursor.
-     * @param Key The key associated to this instruction.
+     * @brief Signal emitted once the dictionary is loaded and the suggestions of the current buffer are displayed.
      */
-    void SendOrderToTextField(Qt::Key Key);
+    void DictionaryReady(void);
 
+public: // Methods
     /**
-     * @brief Signal emitted to switch all concerned text on the UI depending on the shift state.
-     * @param ShiftKey the state of the Shift Key.
-     * @param CharGroup the current char group. Only the inner tile group use this parameter.
+     * @brief Constructor for the Controller class.
+     * @param parent Pointer to the parent object (optional).
      */
-    void ToggleTextsOnShift(ShiftState_t ShiftKey, uint8_t CharGroup);
+    explicit Controller(QObject *parent = nullptr);
 
-public: // Methods
     /**
-     * @brief Constructor for the Controller class.
+     * @brief Makes a source drive this Controller, besides the ones already added.
+     * @param Source The source, whose inputs go to HandleInput.
      */
-    explicit Controller(QWidget *parent = nullptr);
+    void AddInputSource(const InputSource *Source);
 
     /**
-     * @brief Getter for the controller brand.
-     * @return the controller brand.
+     * @brief Setter for the dictionary, once loaded. Ignored if the Controller already has one.
+     * @param Dictionary The Trie to query, shared with the other sessions.
+     *
+     * @details Called when the dictionary built in the background at construction is ready. Tools that can't wait
+     * for the event loop may call it with Trie::Shared() right after the construction.
      */
-    brand_t GetBrand(void) const;
+    void SetDictionary(const QSharedPointer<const Trie> &Dictionary);
 
     /**
      * @brief forces the GUI to be coherent at initialization.
@@ -122,31 +132,92 @@ public: // Methods
      */
     void InitializeTilesContent(void);
 
-private: // Methods
     /**
-     * @brief Checks if the connected gamepad is in the forbidden controllers list.
-     * @param controllerName Name of the gamepad.
-     * @return False if the controller is in the forbidden list, true else.
-     * @see _ForbiddenControllers
+     * @brief Applies the active KeyboardLayout, once it changed, to the wheel, the guides and the autocompleter.
+     *
+     * @details The selected group, the shift state and the typed word are kept: only the texts change, and the
+     * suggestions are queried again for the tiles of the new layout.
+     */
+    void ReloadLayout(void);
+
+    /**
+     * @brief Entry point of the live gamepad events, timestamped with the clock of the Controller.
+     * @param Input The physical input that changed.
+     * @param Value The new value of the input.
+     * @see HandleTimedInput
+     */
+    void HandleInput(const GamepadInput_t Input, const double Value);
+
+    /**
+     * @brief Entry point of every gamepad event, the timestamp given being the clock of the sticks dwell time.
+     * @details An InputReplayer or a simulator gives the timestamps of the log or of its model: the dwell time then
+     * doesn't depend on the pace of the replay.
+     * @param Input The physical input that changed.
+     * @param Value The new value of the input.
+     * @param Timestamp The time of the event, in microseconds, never decreasing.
+     */
+    void HandleTimedInput(const GamepadInput_t Input, const double Value, const quint64 Timestamp);
+
+    /**
+     * @brief Brings the sticks back to the center without typing anything, once their source is gone.
      *
-     * @todo Rework it to automatically detect if a controller has 2 sticks and the 12 buttons.
+     * @details The last positions of the sticks are meaningless, and an unfinished swipe is dropped. The buffer, the
+     * shift state and the selected group are kept, so a pad disconnected with a stick at the border doesn't type when
+     * another one is attached.
+     */
+    void ResetInputs(void);
+
+    /**
+     * @brief Setter for the recorder.
+     * @param Recorder The recorder to store every handled event, or nullptr to stop recording.
+     */
+    void SetRecorder(InputRecorder *Recorder);
+
+    /**
+     * @brief Getter for the metrics of a stick state machine.
+     * @param Stick The stick.
+     * @return The transitions of the stick, and the ones a single threshold logic would have done.
+     */
+    StickMetrics_t GetStickMetrics(const stick_t Stick) const;
+
+    /**
+     * @brief Estimates the signals the stick state machines saved.
+     * @return The transitions suppressed by the state machines, multiplied by the average signals emitted per
+     * transition of their stick.
+     */
+    quint64 GetSuppressedEmissions(void) const;
+
+    /**
+     * @brief Getter for the prefetching counters of the autocompleter.
+     * @return The counters since the construction.
      */
-    bool IsItAllowed(const QString &controllerName) const;
+    PrefetchStats_t GetPrefetchStats(void) const;
 
     /**
-     * @brief Determine the brand of the Controller.
-     * @param controllerName Name of the gamepad.
-     * @return The brand of the controller.
+     * @brief Getter for the swipes counters.
+     * @return The counters since the construction.
      */
-    brand_t WhatsTheBrand(const QString &controllerName) const;
+    SwipeStats_t GetSwipeStats(void) const;
 
     /**
-     * @brief Try to autodetect the controller brand by seeking for keywords.
-     * @param controllerName Name of the gamepad.
-     * @return The detected brand of the controller, or Xbox as default.
+     * @brief Getter for the number of events handled.
+     * @return The events received by HandleInput since the construction.
      */
-    brand_t ControllerBrandAutodetect(const QString &controllerName) const;
+    quint64 GetHandledInputs(void) const;
 
+    /**
+     * @brief Getter for the number of signals emitted.
+     * @return The signals emitted since the construction, every signal of the Controller included.
+     */
+    quint64 GetEmissions(void) const;
+
+    /**
+     * @brief Getter for the counters of the view model, telling how many redundant updates were not sent.
+     * @return The counters since the construction.
+     */
+    ViewModelStats_t GetViewModelStats(void) const;
+
+private: // Methods
     /**
      * @brief Set the letter to send to the text field.
      * @param CharTileIndex The char tile selected.
@@ -165,37 +236,18 @@ private: // Methods
      * @param joystick The joystick that triggered the update.
      * @param Axis Which axis (X or Y) is updated.
      * @param AxisValue New value of the axis.
+     * @param Timestamp The time of the event, in microseconds.
      */
-    void UpdateAxis(stick_t Joystick, axis_t Axis, double AxisValue);
-
-    /**
-     * @brief Updates the radius when the joystick is moved.
-     * @param joystick The joystick that triggered the update.
-     */
-    void UpdateRadius(stick_t Joystick);
-
-    /**
-     * @brief Helper function to determine if the stick is at the border or not.
-     * @param Stick The stick that triggered the update.
-     * @return The narmalized Radius.
-     */
-    StickPosition_t NormalizeRadius(const stick_t Stick) const;
+    void UpdateAxis(stick_t Joystick, axis_t Axis, double AxisValue, const quint64 Timestamp);
 
     /**
      * @brief Dispatcher function on stick releases.
-     * @param NewRadius The newer to radius, to be compared to the current one.
      * @param Stick The stick that triggered the update.
      */
-    void StickReleased(const StickPosition_t NewRadius, const stick_t Stick);
+    void StickReleased(const stick_t Stick);
 
     /**
-     * @brief Updates the angle of the joystick.
-     * @param joystick The joystick that triggered the update.
-     */
-    void UpdateAngle(stick_t Joystick);
-
-    /**
-     * @brief Updates the selected tile based on the joystick's position.
+     * @brief Applies the tile selected by the stick state machine.
      * @param joystick The joystick that triggered the update.
      */
     void UpdateSelectedTile(stick_t Joystick);
@@ -224,8 +276,8 @@ private: // Methods
      * The reason is unknown, but the consequence is that pressing □ on
      * Dualsense will trigger the same behaviour than pressing Y on Xbox
      * controller.
-     * The conditions in the `connect` Statement are here to prevent this,
-     * and ensure that pressing the "top button" will trigger the same
+     * GamepadInput swaps these two buttons depending on the brand, to
+     * ensure that pressing the "top button" will trigger the same
      * behaviour whatever the brand is.
      */
     void ButtonPressed(const feature_t Features, double ButtonValue = 0.0);
@@ -242,6 +294,21 @@ private: // Methods
      */
     void ShiftButton(void);
 
+    /**
+     * @brief Handler for the swipe trigger: starts recording the visited tiles, or decodes them into a word.
+     * @param ButtonValue The value of the analog trigger.
+     *
+     * @details While the trigger is held, the right stick slides from letter to letter instead of typing each of
+     * them, and the left stick can change the char group in the middle of the word. Releasing the trigger types the
+     * most frequent matching word, followed by a space.
+     */
+    void SwipeButton(const double ButtonValue);
+
+    /**
+     * @brief Decodes the visited tiles and types the best word.
+     */
+    void SwipeEnded(void);
+
     /**
      * @brief Emits the event to type a char in the text field and call ToggleShift.
      * @param Letter the letter to type.
@@ -258,43 +325,18 @@ private: // Methods
      */
     void QueryingSuggestions(void);
 
-private: // Attributes
-    /**
-     * @brief List of forbidden controllers.
-     * @todo Add a menu to select the desired controller.
-     *
-     * @details It's meant to exclude non-pertinent devices recognized
-     * as controller, such as the ASUS ROG Chakram. I found nothing to
-     * automatically filter unadapted controllers.
-     */
-    const QMap<QString, brand_t> _TestedControllers = {
-        {"Microsoft X-Box One S pad", XBOX},
-        {"Sony Interactive Entertainment DualSense Wireless Controller", PLAYSTATION},
-        {"Nintendo Co., Ltd. Pro Controller", NINTENDO}
-    };
-
-    /**
-     * @brief List of forbidden controllers.
-     * @todo Add a menu to select the desired controller.
-     *
-     * @details It's meant to exclude non-pertinent devices recognized
-     * as controller, such as the ASUS ROG Chakram. I found nothing to
-     * automatically filter unadapted controllers.
-     */
-    const QVector<QString> _ForbiddenControllers = {
-        "ASUSTeK ROG CHAKRAM"
-    };
-
     /**
-     * @brief Pointer to the selected controller among the one physically connected.
+     * @brief Emits UpdateWheel with the changes recorded since the last call that the wheel doesn't display yet, if
+     * any, and forgets them.
      */
-    QGamepad *_SelectedController;
+    void PublishWheelDelta(void);
 
     /**
-     * @brief Stores the selected controller's brand.
+     * @brief Connects every signal of the Controller to a counter, to measure the downstream fan-out.
      */
-    brand_t _Brand;
+    void CountEmissions(void);
 
+private: // Attributes
     /**
      * @brief Stores current positions of the joysticks.
      *
@@ -303,18 +345,16 @@ private: // Attributes
     QVector<QVector<double>> _AxisPosition;
 
     /**
-     * @brief Stores the angle of the joysticks.
+     * @brief Turns the positions of the joysticks into tile selections and releases.
      *
      * 2*1 QVector, Indexed with [stick_t].
      */
-    QVector<double> _Angles;
+    QVector<StickStateMachine> _Sticks;
 
     /**
-     * @brief Stores the radius of the joysticks.
-     *
-     * 2*1 QVector, Indexed with [stick_t].
+     * @brief The clock timestamping the live events, for the dwell time.
      */
-    QVector<double> _Radius;
+    QElapsedTimer _Clock;
 
     /**
      * @brief Stores the Index of the selected tile of the joysticks.
@@ -334,15 +374,72 @@ private: // Attributes
     bool _CapsLockState;
 
     /**
-     * @brief The controller's instance of Autocomplete.
+     * @brief The controller's instance of Autocomplete, deleted with it along with its reference to the dictionary.
      */
-    Autocomplete* _Autocompleter;
+    QScopedPointer<Autocomplete> _Autocompleter;
 
     /**
      * @brief Holds the words suggested by autocompleter.
      */
     QVector<QString> _Suggestions;
 
+    /**
+     * @brief The recorder storing the handled events, nullptr when the session is not recorded.
+     */
+    InputRecorder* _Recorder;
+
+    /**
+     * @brief Counts all the signals emitted by the Controller.
+     */
+    quint64 _Emissions;
+
+    /**
+     * @brief Counts the signals emitted because of a stick transition.
+     *
+     * 2*1 QVector, Indexed with [stick_t].
+     */
+    QVector<quint64> _StickEmissions;
+
+    /**
+     * @brief Decodes the swipes against the shared dictionary.
+     */
+    SwipeDecoder _Decoder;
+
+    /**
+     * @brief True while the swipe trigger is held.
+     */
+    bool _SwipeActive;
+
+    /**
+     * @brief The tiles visited by the current swipe.
+     */
+    QVector<SwipeKey_t> _SwipePath;
+
+    /**
+     * @brief The swipes counters.
+     */
+    SwipeStats_t _SwipeStats;
+
+    /**
+     * @brief The changes of the wheel caused by the event being handled, sent by PublishWheelDelta.
+     */
+    WheelDelta _WheelDelta;
+
+    /**
+     * @brief The state of the wheel published so far, to send only what changed.
+     */
+    WheelViewModel _ViewModel;
+
+    /**
+     * @brief Counts the events received by HandleInput.
+     */
+    quint64 _HandledInputs;
+
+    /**
+     * @brief True if the event being handled edited the text field.
+     */
+    bool _TextEdited;
+
 };
 
 #endif // CONTROLLER_H
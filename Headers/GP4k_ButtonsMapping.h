@@ -142,6 +142,12 @@ inline const feature_t COLON        = {"□:", Qt::Key_Colon, PUNCTUATION};
  */
 inline const feature_t SEMI_COLON   = {"□;", Qt::Key_Semicolon, PUNCTUATION};
 
+/**
+ * @brief The feature of the inputs that are not buttons of the layout, and of the buttons left unmapped
+ * (NONE in a layout file)
+ */
+inline const feature_t FEATURE_NONE = {"", Qt::Key_unknown, NO_CHAR_CAT};
+
 /**
  * @brief The PhysicalButton_t describe what's associated to controller button
  *
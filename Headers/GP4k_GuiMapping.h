@@ -19,13 +19,14 @@
  * @details Positions and sizes of all components are based on an integer grid from Figma.
  * CELL_SIZE is the size of one grid cell. WINDOW_SIZE_X and WINDOW_SIZE_Y are
  * calculated based on this CELL_SIZE and are used to set the window size.
+ * This is the size at scale 1: the size used at runtime is GuiScale::CellSize, chosen for the screen at startup.
  * @default 28
  */
 #define CELL_SIZE 20
 
 /**
  * @def GLOBAL_FONT_SIZE
- * @brief Defines the font size used for the whole project.
+ * @brief Defines the font size used for the whole project, at scale 1. See GuiScale::FontSize.
  * @default CELL_SIZE * 6/10
  */
 #define GLOBAL_FONT_SIZE CELL_SIZE * 6/10
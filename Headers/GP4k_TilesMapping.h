@@ -3,7 +3,9 @@
 
 #include <QVector>
 #include <QString>
-#include <QMap>
+
+#include "Headers/CharIndex.h"
+#include "Headers/GP4k_Typedefs.h"
 
 /**
  * @def EUR
@@ -15,14 +17,14 @@
 
 /**
  * @def CharGroup_t
- * @brief define a group of characters to be displayed by the 8 tiles of a group.
+ * @brief define a group of characters to be displayed by the 8 tiles of a group, as held by the KeyboardLayout.
  */
 using CharGroup_t = QVector<QString>;
 
 /* ------------------ User code starts here  ------------------
  * The characters associated to each tile can be switched here.
- * Be careful while modifying this file: There is no "protection"
- * preserving you from forgetting a character.
+ * The tables are checked at compile time, after the user code: a
+ * forgotten letter or a character on two tiles doesn't build.
  * It's advised to modify this file only after running
  * `Python/Generating_Disposition/` scripts.
  */
@@ -31,10 +33,11 @@ using CharGroup_t = QVector<QString>;
  * @brief The collection of char groups for the inner tiles.
  * @details a chargroup is selected with [ShiftKeyState][CharGroupIndex]
  * where ShiftKeyState and CharGroupIndex defined by the Controller at
- * runtime. A function requiring a chargroup will use it with a loop iterating
- * over it.
+ * runtime. The tiles left to the suggestions are not written: they are empty.
+ * UTF-8 string views, built by the compiler: the engine reads the layout
+ * through KeyboardLayout, which converts them once.
  */
-inline const QVector<QVector<CharGroup_t>> InnerTilesChars = {
+inline constexpr TilesTable_t InnerTilesChars = {
     { // NOT_SHIFTED
         {"t", "r", "s", "h", "e", "a"},
         {"q", "f", "l", "k", "b"},
@@ -61,10 +64,9 @@ inline const QVector<QVector<CharGroup_t>> InnerTilesChars = {
  * @brief The collection of char groups for the outer tiles.
  * @details a chargroup is selected with [ShiftKeyState]
  * where ShiftKeyState and CharGroupIndex defined by the Controller at
- * runtime. A function requiring a chargroup will use it with a loop iterating
- * over it.
+ * runtime.
  */
-inline const QVector<CharGroup_t> OuterTilesTexts ={
+inline constexpr OuterTable_t OuterTilesTexts ={
 
     { // NOT_SHIFTED
         "t r s h e a",
@@ -92,8 +94,22 @@ inline const QVector<CharGroup_t> OuterTilesTexts ={
 /**
  * @brief Defines the number of suggestion tiles of each different inner tile group.
  */
-inline const QVector<uint8_t> GroupsSuggestionsMap = {2, 3, 3, 3, 3, 0, 0, 0};
+inline constexpr uint8_t GroupsSuggestionsMap[NUMBER_OF_TILES] = {2, 3, 3, 3, 3, 0, 0, 0};
 
 /* ------------------ User code ends here ------------------ */
 
+/**
+ * @brief The tile of each character of InnerTilesChars, computed by the compiler.
+ */
+inline constexpr CharIndex BuiltinCharIndex = CharIndex::FromTiles(InnerTilesChars);
+
+static_assert(GroupsFitTiles(InnerTilesChars, GroupsSuggestionsMap),
+              "Each group of InnerTilesChars must fill the tiles left by its GroupsSuggestionsMap, in both shift states");
+static_assert(HasNoDuplicateChar(InnerTilesChars),
+              "A character of InnerTilesChars is on two tiles");
+static_assert(HasChars(BuiltinCharIndex, LAYOUT_REQUIRED_CHARS),
+              "A letter or a digit is missing from InnerTilesChars");
+static_assert(HasOuterTexts(OuterTilesTexts),
+              "Each outer tile needs a text in OuterTilesTexts, in both shift states");
+
 #endif // GP4K_TILESMAPPING_H
@@ -9,6 +9,8 @@
 #include <QString>
 #include <QMap>
 
+#include <string_view>
+
 /**
  * @brief Represent the state of a button.
  *
@@ -47,5 +49,59 @@ enum brand_t { XBOX, PLAYSTATION, NINTENDO};
  */
 enum LabelPosition_t { LABEL_TOP, LABEL_BOTTOM, LABEL_RIGHT, LABEL_LEFT};
 
+/**
+ * @brief describe if a stick is at the border or not.
+ */
+enum StickPosition_t : uint8_t{
+    CENTER = 0,
+    BORDER = 1
+};
+
+/**
+ * @brief Represents every physical input of the gamepad GP4k listens to.
+ *
+ * @details The buttons are named after the PhysicalButton_t they trigger, not after the QGamepad signal: the brand
+ * specific swaps (see Controller::ButtonPressed) are already resolved. A recorded session is thus replayed the same
+ * way whatever the brand of the controller used to record it.
+ */
+enum GamepadInput_t : uint8_t {
+    INPUT_AXIS_LEFT_X,
+    INPUT_AXIS_LEFT_Y,
+    INPUT_AXIS_RIGHT_X,
+    INPUT_AXIS_RIGHT_Y,
+    INPUT_BUTTON_X,
+    INPUT_BUTTON_Y,
+    INPUT_BUTTON_LB,
+    INPUT_BUTTON_RB,
+    INPUT_BUTTON_LT,
+    INPUT_DPAD_UP,
+    INPUT_DPAD_DOWN,
+    INPUT_DPAD_LEFT,
+    INPUT_DPAD_RIGHT,
+    INPUT_BUTTON_RT, /**< Held to swipe. Last, so the logs recorded before it stay valid. */
+    NUMBER_OF_INPUTS
+};
+
 #define DEFAULT_TILE 9U
+#define NUMBER_OF_TILES 8U
+#define MAX_TILE_INDEX (NUMBER_OF_TILES - 1U)
+
+/**
+ * @brief The UTF-8 texts of the inner tiles, [ShiftState_t][Group][Tile]. The tiles left to the suggestions are empty.
+ */
+using TilesTable_t = std::string_view[2][NUMBER_OF_TILES][NUMBER_OF_TILES];
+
+/**
+ * @brief The UTF-8 texts of the outer tiles, [ShiftState_t][Tile].
+ */
+using OuterTable_t = std::string_view[2][NUMBER_OF_TILES];
+
+/**
+ * @brief The tile typing a character.
+ */
+struct CharPosition_t {
+    uint8_t Group;      /**< The char group, selected with the left stick. */
+    uint8_t Tile;       /**< The tile of the group, selected with the right stick. */
+    ShiftState_t Shift; /**< The shift state in which the tile types the character. */
+};
 #endif // GP4K_TYPEDEFS_H
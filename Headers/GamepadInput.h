@@ -0,0 +1,145 @@
+/* GamepadInput.h */
+
+#ifndef GAMEPADINPUT_H
+#define GAMEPADINPUT_H
+
+#include <QtGamepad/QGamepad>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+#include "Headers/GP4k_Typedefs.h"
+#include "Headers/InputSource.h"
+
+/**
+ * @brief The GamepadInput class is the InputSource of a physical gamepad, through QGamepad.
+ *
+ * @details It picks an allowed gamepad that drives no other session, follows the connections and disconnections of
+ * the pads, and detects their brand to deliver the buttons in the same logical order whatever the pad.
+ */
+class GamepadInput : public InputSource
+{
+    Q_OBJECT
+
+public: // Methods
+    /**
+     * @brief Constructor of the GamepadInput.
+     * @param GamepadId The id of the gamepad driving this session, -1 to use the first allowed one.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit GamepadInput(const int GamepadId = -1, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor of the GamepadInput. Frees its gamepad for the other sessions.
+     */
+    ~GamepadInput();
+
+    /**
+     * @brief Lists the connected gamepads that are not forbidden.
+     * @return The ids of the allowed gamepads, in the order of the QGamepadManager.
+     * @see IsItAllowed
+     */
+    static QList<int> AllowedGamepads(void);
+
+    /**
+     * @brief Getter for the controller brand.
+     * @return the controller brand.
+     */
+    brand_t GetBrand(void) const;
+
+signals:
+    /**
+     * @brief Emitted when the attached gamepad is of another brand than the previous one.
+     * @param Brand The brand of the newly attached gamepad.
+     */
+    void BrandChanged(const brand_t Brand);
+
+private: // Methods
+    /**
+     * @brief Makes a gamepad drive this session.
+     * @param GamepadId The id of the gamepad, in the QGamepadManager.
+     */
+    void AttachGamepad(const int GamepadId);
+
+    /**
+     * @brief Attaches the first allowed gamepad that doesn't drive another session.
+     * @return True if a gamepad has been attached, false else.
+     */
+    bool AttachFirstAvailableGamepad(void);
+
+    /**
+     * @brief Stops listening to the gamepad and emits InputLost, keeping the session.
+     */
+    void DetachGamepad(void);
+
+    /**
+     * @brief Checks if the connected gamepad is in the forbidden controllers list.
+     * @param controllerName Name of the gamepad.
+     * @return False if the controller is in the forbidden list, true else.
+     * @see _ForbiddenControllers
+     *
+     * @todo Rework it to automatically detect if a controller has 2 sticks and the 12 buttons.
+     */
+    static bool IsItAllowed(const QString &controllerName);
+
+    /**
+     * @brief Determine the brand of the Controller.
+     * @param controllerName Name of the gamepad.
+     * @return The brand of the controller.
+     */
+    static brand_t WhatsTheBrand(const QString &controllerName);
+
+    /**
+     * @brief Try to autodetect the controller brand by seeking for keywords.
+     * @param controllerName Name of the gamepad.
+     * @return The detected brand of the controller, or Xbox as default.
+     */
+    static brand_t ControllerBrandAutodetect(const QString &controllerName);
+
+private: // Attributes
+    /**
+     * @brief List of the tested controllers, and their brand.
+     */
+    inline static const QMap<QString, brand_t> _TestedControllers = {
+        {"Microsoft X-Box One S pad", XBOX},
+        {"Sony Interactive Entertainment DualSense Wireless Controller", PLAYSTATION},
+        {"Nintendo Co., Ltd. Pro Controller", NINTENDO}
+    };
+
+    /**
+     * @brief List of forbidden controllers.
+     * @todo Add a menu to select the desired controller.
+     *
+     * @details It's meant to exclude non-pertinent devices recognized
+     * as controller, such as the ASUS ROG Chakram. I found nothing to
+     * automatically filter unadapted controllers.
+     */
+    inline static const QVector<QString> _ForbiddenControllers = {
+        "ASUSTeK ROG CHAKRAM"
+    };
+
+    /**
+     * @brief The gamepads attached to a session, shared by all the GamepadInputs so two sessions never share a pad.
+     */
+    inline static QSet<int> _ClaimedGamepads;
+
+    /**
+     * @brief Pointer to the selected controller among the one physically connected.
+     * @details Created once: attaching another gamepad only changes its device id.
+     */
+    QGamepad *_SelectedController;
+
+    /**
+     * @brief The id of the attached gamepad, -1 while none.
+     */
+    int _GamepadId;
+
+    /**
+     * @brief Stores the selected controller's brand.
+     */
+    brand_t _Brand;
+};
+
+#endif // GAMEPADINPUT_H
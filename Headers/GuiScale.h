@@ -0,0 +1,72 @@
+/* GuiScale.h */
+
+#ifndef GUISCALE_H
+#define GUISCALE_H
+
+#include <QRect>
+#include <QSize>
+
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @def REFERENCE_DPI
+ * @brief The logical DPI for which the GUI is drawn at CELL_SIZE.
+ */
+#define REFERENCE_DPI 96.0
+
+/**
+ * @def MIN_CELL_SIZE
+ * @brief The smallest cell size, in pixels, under which the texts become unreadable.
+ */
+#define MIN_CELL_SIZE 10
+
+/**
+ * @brief The GuiScale class holds the size of a grid cell, chosen once at startup for the target screen.
+ *
+ * @details CELL_SIZE is the size of a cell at scale 1. The scale is either configured, or the logical DPI of the
+ * primary screen relative to REFERENCE_DPI, reduced if needed so the window fits the available screen area: the same
+ * build runs on a 720p handheld and on a 4K TV. Every placement, font and raster of the GUI is computed from the
+ * resulting cell size, so it must be initialized before the first widget is created.
+ */
+class GuiScale {
+public: // Methods
+    /**
+     * @brief Chooses the cell size. Requires the QGuiApplication.
+     * @param ConfiguredScale The scale to use, or 0 to derive it from the primary screen.
+     */
+    static void Initialize(const double ConfiguredScale = 0.0);
+
+    /**
+     * @brief Getter for the size of a grid cell.
+     * @return The size of a cell, in logical pixels. CELL_SIZE until Initialize is called.
+     */
+    static int CellSize(void);
+
+    /**
+     * @brief Converts a placement on the grid to logical pixels.
+     * @param Placement The placement, in cells.
+     * @return The rectangle, in logical pixels.
+     */
+    static QRect ToPixels(const placement_t &Placement);
+
+    /**
+     * @brief Getter for the font size of the whole project.
+     * @return GLOBAL_FONT_SIZE at the current scale.
+     */
+    static int FontSize(void);
+
+    /**
+     * @brief Getter for the size of the window.
+     * @return WINDOW_SIZE_X by WINDOW_SIZE_Y at the current scale.
+     */
+    static QSize WindowSize(void);
+
+private: // Attributes
+    /**
+     * @brief The size of a grid cell, in logical pixels.
+     */
+    inline static int _CellSize = CELL_SIZE;
+};
+
+#endif // GUISCALE_H
@@ -45,6 +45,12 @@ public slots:
      */
     void SetGuideText(const ShiftState_t ShiftKey);
 
+    /**
+     * @brief Restyles the guide for a gamepad brand: the icon of the button and the color of its text.
+     * @param Brand The brand of the attached gamepad.
+     */
+    void SetBrand(const brand_t Brand);
+
 private: // Attributes
     /**
      * @brief The associated physical button.
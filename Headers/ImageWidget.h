@@ -8,7 +8,8 @@
  * @brief The ImageWidget class Used to add images to the GUI
  *
  * This class extends QLabel to provide additional functionality, such as setting its geometry
- * using a grid map instead of pixel coordinates.
+ * using a grid map instead of pixel coordinates. The image is taken from the RasterAtlas at the
+ * size of the widget once it's placed.
  */
 class ImageWidget : public QLabel
 {
@@ -26,6 +27,18 @@ public:
      * @param WidgetPlacement The placement parameters of the widget.
      */
     void SetGeometryOnGrid(const placement_t& WidgetPlacement);
+
+    /**
+     * @brief Replaces the image, read at the size of the already placed widget.
+     * @param ImagePath The path to the new image file.
+     */
+    void SetImage(const QString& ImagePath);
+
+private: // Attributes
+    /**
+     * @brief The path to the image file, read once the size of the widget is known.
+     */
+    QString _ImagePath;
 };
 
 #endif // IMAGEWIDGET_H
@@ -0,0 +1,114 @@
+/* InputRecorder.h */
+
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include <QString>
+#include <QVector>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @def INPUT_LOG_MAGIC
+ * @brief The first four bytes of an input log: "GP4R" (GP4k Recording).
+ */
+#define INPUT_LOG_MAGIC 0x47503452U
+
+/**
+ * @def INPUT_LOG_VERSION
+ * @brief Version of the input log format, to be incremented when the layout of InputEvent_t changes.
+ */
+#define INPUT_LOG_VERSION 2U
+
+/**
+ * @def INPUT_LOG_EVENT_SIZE
+ * @brief Size of an event in an input log, in bytes: its timestamp, input and value.
+ */
+#define INPUT_LOG_EVENT_SIZE (sizeof(quint64) + sizeof(quint8) + sizeof(float))
+
+/**
+ * @brief Describes one timestamped gamepad event, as received by the Controller.
+ *
+ * @details Serialized on 13 bytes: 8 for the timestamp, 1 for the input and 4 for the value (single precision).
+ */
+struct InputEvent_t {
+    /**
+     * @brief The time of the event given to the Controller, in microseconds: a session can last more than the 71
+     * minutes of 32 bits.
+     */
+    quint64 Timestamp;
+
+    /**
+     * @brief The physical input that changed.
+     */
+    GamepadInput_t Input;
+
+    /**
+     * @brief The new value of the input: [-1, 1] for the axes, [0, 1] for the buttons.
+     */
+    float Value;
+};
+
+/**
+ * @brief Holds a full recorded session: the events, and the text they produced in the text field.
+ */
+struct InputLog_t {
+    /**
+     * @brief The events, sorted by timestamps.
+     */
+    QVector<InputEvent_t> Events;
+
+    /**
+     * @brief The content of the text field at the end of the recording.
+     * @details Used by the InputReplayer to check the replay is deterministic.
+     */
+    QString ExpectedText;
+};
+
+/**
+ * @brief The InputRecorder class stores the gamepad events received by the Controller, to write them in a compact
+ * binary log that can be replayed later by the InputReplayer.
+ *
+ * @details The recorder only stores the events in memory: writing is done once, on Save(), so recording does not add
+ * any file access on the input path.
+ */
+class InputRecorder {
+public: // Methods
+    /**
+     * @brief Stores an event.
+     * @param Input The physical input that changed.
+     * @param Value The new value of the input.
+     * @param Timestamp The time of the event given to the Controller, in microseconds, replayed as is.
+     */
+    void Record(const GamepadInput_t Input, const double Value, const quint64 Timestamp);
+
+    /**
+     * @brief Getter for the number of events recorded so far.
+     * @return The number of events.
+     */
+    int GetEventsCount(void) const;
+
+    /**
+     * @brief Writes the recorded events in a binary log.
+     * @param FilePath The path to the log file. An existing file is overwritten.
+     * @param ResultingText The content of the text field, stored as the expected result of a replay.
+     * @return true if the file has been written, false else.
+     */
+    bool Save(const QString &FilePath, const QString &ResultingText) const;
+
+    /**
+     * @brief Reads a binary log written by Save().
+     * @param FilePath The path to the log file.
+     * @param Log The log to fill.
+     * @return true if the file has been read and is valid, false else.
+     */
+    static bool Load(const QString &FilePath, InputLog_t &Log);
+
+private: // Attributes
+    /**
+     * @brief The events recorded so far.
+     */
+    QVector<InputEvent_t> _Events;
+};
+
+#endif // INPUTRECORDER_H
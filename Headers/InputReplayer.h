@@ -0,0 +1,134 @@
+/* InputReplayer.h */
+
+#ifndef INPUTREPLAYER_H
+#define INPUTREPLAYER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+
+#include "Headers/Controller.h"
+#include "Headers/InputRecorder.h"
+
+/**
+ * @brief Represents the pace at which a log is replayed.
+ */
+enum ReplayMode_t {
+    REPLAY_REAL_TIME,     /**< Events are dispatched at their recorded timestamps. */
+    REPLAY_FAST           /**< Events are dispatched as fast as possible, to measure the throughput. */
+};
+
+/**
+ * @brief Holds the measurements done during a replay.
+ */
+struct ReplayReport_t {
+    /**
+     * @brief Number of events dispatched to the Controller.
+     */
+    int EventsCount;
+
+    /**
+     * @brief Nanoseconds elapsed between the first and the last dispatched event.
+     */
+    qint64 WallTime;
+
+    /**
+     * @brief Nanoseconds spent by the Controller to handle all the events.
+     */
+    qint64 HandlingTime;
+
+    /**
+     * @brief Nanoseconds spent by the Controller to handle the slowest event.
+     */
+    qint64 MaxLatency;
+
+    /**
+     * @brief True if the replay produced exactly the text of the recording.
+     */
+    bool TextMatches;
+};
+
+/**
+ * @brief The InputReplayer class feeds an input log back into a Controller.
+ *
+ * @details The events go through Controller::HandleTimedInput, the very entry point of the QGamepad signals, with
+ * their recorded timestamps: a replay exercises the same code as a live session, and types the same text whatever
+ * its pace. Combined with the offscreen platform, it allows to measure the
+ * latency and throughput of the whole input path on a machine without display nor gamepad.
+ */
+class InputReplayer : public QObject
+{
+    Q_OBJECT
+
+signals:
+    /**
+     * @brief Signal emitted once all the events of the log are dispatched.
+     */
+    void Finished(void);
+
+public: // Methods
+    /**
+     * @brief Constructor of the InputReplayer.
+     * @param Target The Controller receiving the events.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit InputReplayer(Controller *Target, QObject *parent = nullptr);
+
+    /**
+     * @brief Starts the replay. Returns immediately, the events are dispatched from the event loop.
+     * @param Log The log to replay.
+     * @param Mode The pace of the replay.
+     */
+    void Start(const InputLog_t &Log, const ReplayMode_t Mode);
+
+    /**
+     * @brief Builds the report of the replay.
+     * @param ProducedText The content of the text field at the end of the replay.
+     * @return The measurements of the replay.
+     */
+    ReplayReport_t GetReport(const QString &ProducedText) const;
+
+private: // Methods
+    /**
+     * @brief Dispatches all the events which timestamp is reached, then schedules the next call.
+     */
+    void DispatchDueEvents(void);
+
+    /**
+     * @brief Dispatches all the remaining events without waiting.
+     */
+    void DispatchAllEvents(void);
+
+    /**
+     * @brief Sends one event to the Controller and measures how long it takes to handle it.
+     * @param Event The event to dispatch.
+     */
+    void DispatchEvent(const InputEvent_t &Event);
+
+private: // Attributes
+    /**
+     * @brief The Controller receiving the events.
+     */
+    Controller *_Target;
+
+    /**
+     * @brief The log being replayed.
+     */
+    InputLog_t _Log;
+
+    /**
+     * @brief The index of the next event to dispatch.
+     */
+    int _NextEvent;
+
+    /**
+     * @brief The clock started with the replay.
+     */
+    QElapsedTimer _Clock;
+
+    /**
+     * @brief The measurements accumulated during the replay.
+     */
+    ReplayReport_t _Report;
+};
+
+#endif // INPUTREPLAYER_H
@@ -0,0 +1,42 @@
+/* InputSource.h */
+
+#ifndef INPUTSOURCE_H
+#define INPUTSOURCE_H
+
+#include <QObject>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @brief The InputSource class is the interface of the devices driving a Controller.
+ *
+ * @details The Controller only knows the logical inputs of GamepadInput_t: a source translates its device, a QGamepad
+ * in the GUI or any other frontend, into them. The inputs are already those of the layout, the buttons swapped by a
+ * brand included. Connected with Controller::AddInputSource.
+ */
+class InputSource : public QObject
+{
+    Q_OBJECT
+
+signals:
+    /**
+     * @brief Signal emitted each time an input of the device changes.
+     * @param Input The logical input that changed.
+     * @param Value The new value of the input.
+     */
+    void InputChanged(GamepadInput_t Input, double Value);
+
+    /**
+     * @brief Signal emitted when the device is gone, for the Controller to forget the positions of the sticks.
+     */
+    void InputLost(void);
+
+public: // Methods
+    /**
+     * @brief Constructor of the InputSource.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit InputSource(QObject *parent = nullptr) : QObject{parent} {}
+};
+
+#endif // INPUTSOURCE_H
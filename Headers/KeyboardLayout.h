@@ -0,0 +1,251 @@
+/* KeyboardLayout.h */
+
+#ifndef KEYBOARDLAYOUT_H
+#define KEYBOARDLAYOUT_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Headers/CharIndex.h"
+#include "Headers/GP4k_ButtonsMapping.h"
+#include "Headers/GP4k_TilesMapping.h"
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @def LAYOUT_FILE_MAGIC
+ * @brief The first 4 bytes of a compiled layout file, "GP4L". A file not starting with them is read as text.
+ */
+#define LAYOUT_FILE_MAGIC 0x4750344CU
+
+/**
+ * @def LAYOUT_FILE_VERSION
+ * @brief The version of the compiled layout format, increased at each change of its content.
+ */
+#define LAYOUT_FILE_VERSION 1U
+
+/**
+ * @brief The KeyboardLayout class holds the characters of the tiles and the features of the buttons.
+ *
+ * @details The built-in layout is the one of GP4k_TilesMapping.h and GP4k_ButtonsMapping.h. Another one can be
+ * loaded at runtime from a layout file, either a text file written by hand or the binary file gp4k-layoutc compiles
+ * from it:
+ *
+ *     # A line starting with a '#' is a comment. A group starts with its number of suggestion tiles,
+ *     # followed by the chars of its tiles and the text of its outer tile, NOT_SHIFTED and SHIFTED.
+ *     group 2
+ *     lower t r s h e a
+ *     upper T R S H E A
+ *     outer t r s h e a
+ *     outer_upper T R S H E A
+ *     # A button, by the IconName of its PhysicalButton_t, and its features NOT_SHIFTED and SHIFTED.
+ *     button UP COMMA PERIOD
+ *
+ * The groups are in the order of the outer tiles, and the features are named as in GP4k_ButtonsMapping.h; NONE
+ * leaves a button unmapped, as gp4k-layout-optimizer --extended does with a D-pad slot whose punctuation moved to a
+ * tile.
+ *
+ * A layout is validated once loaded: NUMBER_OF_TILES groups fitting on their tiles next to their suggestions, every
+ * button mapped once, no character on two tiles or on a tile and a button, LAYOUT_REQUIRED_CHARS on tiles, and the
+ * space, backspace and shift in both shift states. The lookups of the engine are then precomputed, so that finding a
+ * character, the last char tile of a group or the feature of a button is O(1).
+ *
+ * The active layout is read by the Controller, the wheel and the guides. It's only replaced from the GUI thread,
+ * between two events; see LayoutWatcher for the hot reload.
+ */
+class KeyboardLayout {
+public: // Methods
+    /**
+     * @brief Builds the layout of GP4k_TilesMapping.h and GP4k_ButtonsMapping.h.
+     * @return The built-in layout.
+     */
+    static KeyboardLayout Builtin(void);
+
+    /**
+     * @brief Reads and validates a layout file, compiled or text.
+     * @param Path The file to read.
+     * @param Layout Receives the layout if it's valid, untouched else.
+     * @param Errors Receives the reasons why the file was rejected.
+     * @return True if the layout is valid.
+     */
+    static bool Load(const QString &Path, KeyboardLayout &Layout, QStringList &Errors);
+
+    /**
+     * @brief Parses and validates a layout written as text.
+     * @param Text The content of a layout text file.
+     * @param Layout Receives the layout if it's valid, untouched else.
+     * @param Errors Receives the reasons why the text was rejected, with their line numbers.
+     * @return True if the layout is valid.
+     */
+    static bool FromText(const QString &Text, KeyboardLayout &Layout, QStringList &Errors);
+
+    /**
+     * @brief Reads and validates a compiled layout.
+     * @param Data The content of a compiled layout file.
+     * @param Layout Receives the layout if it's valid, untouched else.
+     * @param Errors Receives the reasons why the data was rejected.
+     * @return True if the layout is valid.
+     */
+    static bool FromBinary(const QByteArray &Data, KeyboardLayout &Layout, QStringList &Errors);
+
+    /**
+     * @brief Builds and validates a copy of the layout whose first groups hold other letters.
+     * @details Each group gets the letters in both cases, and outer tiles listing them separated by spaces. The
+     * suggestion tiles, the other groups and the buttons are kept.
+     * @param Groups The letters of the first groups, in tile order, such as "trshea".
+     * @param Layout Receives the layout if it's valid, untouched else.
+     * @param Errors Receives the reasons why the letters were rejected.
+     * @return True if the layout is valid.
+     */
+    bool WithLetters(const QStringList &Groups, KeyboardLayout &Layout, QStringList &Errors) const;
+
+    /**
+     * @brief Writes the layout as text, in the format read by FromText.
+     * @return The text of the layout.
+     */
+    QString ToText(void) const;
+
+    /**
+     * @brief Compiles the layout, in the format read by FromBinary.
+     * @return The compiled layout.
+     */
+    QByteArray ToBinary(void) const;
+
+    /**
+     * @brief Getter for the layout in use.
+     * @return The active layout, the built-in one until SetActive is called.
+     * @warning The reference is valid until the next SetActive.
+     */
+    static const KeyboardLayout &Active(void);
+
+    /**
+     * @brief Replaces the layout in use. Must be called from the GUI thread.
+     * @param Layout A validated layout.
+     */
+    static void SetActive(const KeyboardLayout &Layout);
+
+    /**
+     * @brief Getter for the chars of the tiles of a group.
+     * @param Shift The shift state.
+     * @param Group The char group.
+     * @return The chars, by tile.
+     */
+    inline const CharGroup_t &InnerChars(const ShiftState_t Shift, const uint8_t Group) const { return _InnerTilesChars[Shift][Group]; }
+
+    /**
+     * @brief Getter for the texts of the outer tiles.
+     * @param Shift The shift state.
+     * @return The texts, by tile.
+     */
+    inline const CharGroup_t &OuterTexts(const ShiftState_t Shift) const { return _OuterTilesTexts[Shift]; }
+
+    /**
+     * @brief Getter for the number of suggestion tiles of a group.
+     * @param Group The char group.
+     * @return The suggestion tiles, the last tiles of the group.
+     */
+    inline uint8_t SuggestionTiles(const uint8_t Group) const { return _GroupsSuggestionsMap[Group]; }
+
+    /**
+     * @brief Getter for the last tile of a group typing a char, the next ones being suggestions.
+     * @param Group The char group.
+     * @return MAX_TILE_INDEX minus the number of suggestion tiles.
+     */
+    inline uint8_t LastCharTile(const uint8_t Group) const { return _LastCharTiles[Group]; }
+
+    /**
+     * @brief Getter for the feature triggered by a button.
+     * @param Input The button.
+     * @param Shift The shift state.
+     * @return The feature. An empty NO_CHAR_CAT feature for the inputs that are not buttons of the layout.
+     */
+    inline const feature_t &ButtonFeature(const GamepadInput_t Input, const ShiftState_t Shift) const { return _InputFeatures[Input * 2 + Shift]; }
+
+    /**
+     * @brief Getter for the feature triggered by a button, from its name.
+     * @param ButtonName The IconName of the PhysicalButton_t.
+     * @param Shift The shift state.
+     * @return The feature. An empty NO_CHAR_CAT feature if no button has this name.
+     */
+    const feature_t &ButtonFeature(const QString &ButtonName, const ShiftState_t Shift) const;
+
+    /**
+     * @brief Finds the button triggering a feature.
+     * @param Feature The feature.
+     * @param Shift The shift state.
+     * @return The input of the button, NUMBER_OF_INPUTS if no button triggers the feature.
+     */
+    GamepadInput_t FindInput(const feature_t &Feature, const ShiftState_t Shift) const;
+
+    /**
+     * @brief Finds the tile typing a character.
+     * @param Character The character.
+     * @param Position Receives the tile, the NOT_SHIFTED one if it's on both.
+     * @return False if no tile types the character.
+     */
+    bool FindChar(const QChar Character, CharPosition_t &Position) const;
+
+    /**
+     * @brief Getter for the tiles typing a character, for the callers iterating over all of them.
+     * @return The tile of each single code point character.
+     */
+    inline const CharIndex &Chars(void) const { return _CharIndex; }
+
+    /**
+     * @brief Getter for the number of char groups.
+     * @return NUMBER_OF_TILES for a validated layout.
+     */
+    inline int GroupsCount(void) const { return _InnerTilesChars.isEmpty() ? 0 : _InnerTilesChars[NOT_SHIFTED].length(); }
+
+private: // Methods
+    /**
+     * @brief Checks the coverage and the duplicates of the layout.
+     * @return The errors found, empty if the layout is valid.
+     */
+    QStringList Validate(void) const;
+
+    /**
+     * @brief Precomputes the lookups. Called once the tables are filled and validated.
+     */
+    void BuildLookups(void);
+
+private: // Attributes
+    /**
+     * @brief The chars of the tiles, [ShiftState_t][Group][Tile], as InnerTilesChars.
+     */
+    QVector<QVector<CharGroup_t>> _InnerTilesChars;
+
+    /**
+     * @brief The texts of the outer tiles, [ShiftState_t][Tile], as OuterTilesTexts.
+     */
+    QVector<CharGroup_t> _OuterTilesTexts;
+
+    /**
+     * @brief The number of suggestion tiles of each group, as GroupsSuggestionsMap.
+     */
+    QVector<uint8_t> _GroupsSuggestionsMap;
+
+    /**
+     * @brief The features of each button, [ShiftState_t], by IconName of the PhysicalButton_t.
+     */
+    QHash<QString, QVector<feature_t>> _ButtonsFeatures;
+
+    /**
+     * @brief Precomputed: the last char tile of each group.
+     */
+    QVector<uint8_t> _LastCharTiles;
+
+    /**
+     * @brief Precomputed: the feature of each input, [GamepadInput_t * 2 + ShiftState_t].
+     */
+    QVector<feature_t> _InputFeatures;
+
+    /**
+     * @brief Precomputed: the tile of each single code point character. Computed by the compiler for the built-in layout.
+     */
+    CharIndex _CharIndex;
+};
+
+#endif // KEYBOARDLAYOUT_H
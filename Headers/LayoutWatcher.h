@@ -0,0 +1,68 @@
+/* LayoutWatcher.h */
+
+#ifndef LAYOUTWATCHER_H
+#define LAYOUTWATCHER_H
+
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+/**
+ * @def LAYOUT_RELOAD_DELAY_MS
+ * @brief Delay between the last change of the layout file and its reload.
+ *
+ * @details An editor may save a file in several writes, or by renaming a temporary file over it: waiting for the
+ * changes to settle avoids loading a half written layout.
+ */
+#define LAYOUT_RELOAD_DELAY_MS 100
+
+/**
+ * @brief The LayoutWatcher class reloads a layout file each time it changes on disk.
+ *
+ * @details A valid file replaces the active KeyboardLayout and LayoutChanged is emitted, for the Controllers to
+ * refresh the wheel and the guides. An invalid file is reported with qWarning and the layout in use is kept, so a
+ * typo while editing the layout never leaves the keyboard unusable.
+ */
+class LayoutWatcher : public QObject
+{
+    Q_OBJECT
+
+signals:
+    /**
+     * @brief Signal emitted once a new layout is active.
+     */
+    void LayoutChanged(void);
+
+public: // Methods
+    /**
+     * @brief Constructor of the LayoutWatcher. The file is expected to be loaded already.
+     * @param Path The layout file to watch.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit LayoutWatcher(const QString &Path, QObject *parent = nullptr);
+
+private: // Methods
+    /**
+     * @brief Loads the file and activates it if it's valid.
+     */
+    void Reload(void);
+
+private: // Attributes
+    /**
+     * @brief The layout file.
+     */
+    QString _Path;
+
+    /**
+     * @brief Notifies the changes of the file.
+     */
+    QFileSystemWatcher _Watcher;
+
+    /**
+     * @brief Delays the reload until the changes settle.
+     */
+    QTimer _Debounce;
+};
+
+#endif // LAYOUTWATCHER_H
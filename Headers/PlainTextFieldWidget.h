@@ -0,0 +1,79 @@
+#ifndef PLAINTEXTFIELDWIDGET_H
+#define PLAINTEXTFIELDWIDGET_H
+
+#include <QPlainTextEdit>
+#include <QTextCursor>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @brief Represents the two implementations of the text field.
+ */
+enum TextFieldMode_t {
+    TEXT_FIELD_RICH,   /**< QTextEditCustom: the orders are replayed as key events. */
+    TEXT_FIELD_PLAIN   /**< PlainTextFieldWidget: for long documents. */
+};
+
+/**
+ * @brief The PlainTextFieldWidget class is the text field for long documents, such as chat logs or notes.
+ *
+ * @details Unlike QTextEditCustom, the text is plain, laid out line by line by QPlainTextEdit, and the orders are
+ * applied directly on a QTextCursor instead of being replayed as key events. All the edits of a gamepad event, such
+ * as a suggestion followed by its space, form a single edit block: the document signals, the relayout and the undo
+ * step happen once, and the visible cursor is moved once, when EndEditBlock is called.
+ */
+class PlainTextFieldWidget : public QPlainTextEdit
+{
+    Q_OBJECT
+
+public slots:
+    /**
+     * @brief Types a text at the cursor.
+     * @param Text The text to type.
+     */
+    void InsertText(const QString &Text);
+
+    /**
+     * @brief Handle the special instructions like backspace or others related button features
+     * @param Key They key associated to the action to perform.
+     * @see GP4k_ButtonsMapping.h
+     */
+    void OrderReceived(const Qt::Key Key);
+
+    /**
+     * @brief Closes the edit block opened by the edits of the current event, if any.
+     */
+    void EndEditBlock(void);
+
+public:
+    /**
+     * @brief PlainTextFieldWidget Constructor
+     * @param parent Pointer to the parent widget (optional).
+     */
+    explicit PlainTextFieldWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief SetGeometryOnGrid place the widget in the window using the grid map instead of the pixel map.
+     * @param WidgetPlacement The placement parameters of the widget.
+     */
+    void SetGeometryOnGrid(const placement_t WidgetPlacement);
+
+private: // Methods
+    /**
+     * @brief Opens an edit block at the visible cursor, unless the current event already did.
+     */
+    void BeginEditBlock(void);
+
+private: // Attributes
+    /**
+     * @brief The cursor applying the edits of the current event.
+     */
+    QTextCursor _Cursor;
+
+    /**
+     * @brief True while an edit block is open.
+     */
+    bool _IsEditing;
+};
+
+#endif // PLAINTEXTFIELDWIDGET_H
@@ -0,0 +1,61 @@
+/* RasterAtlas.h */
+
+#ifndef RASTERATLAS_H
+#define RASTERATLAS_H
+
+#include <QHash>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+
+/**
+ * @brief The RasterAtlas class holds every image of the GUI, rasterized once at the size it's displayed.
+ *
+ * @details The icons and the tile backgrounds are SVG. Instead of loading them at their native size, then smoothly
+ * rescaling them in each widget, the SVG is read directly at the target size and at the device pixel ratio through
+ * QImageReader::setScaledSize. An image requested again at the same size, by another widget or another window, is
+ * the same implicitly shared QPixmap. The atlas lives in the GUI thread, as QPixmap does.
+ */
+class RasterAtlas {
+public: // Methods
+    /**
+     * @brief Getter for an image at a given size, rasterized at the first request.
+     * @param File The path of the image.
+     * @param Size The size it's displayed at, in logical pixels.
+     * @param AspectMode How the image fits the size: KeepAspectRatio may return a smaller image.
+     * @param Angle A rotation applied after the rasterization, a multiple of 90°.
+     * @return The rasterized image. A null pixmap if the file can't be read.
+     */
+    static const QPixmap& Get(const QString &File, const QSize &Size,
+                              const Qt::AspectRatioMode AspectMode = Qt::KeepAspectRatio, const int Angle = 0);
+
+    /**
+     * @brief Counts the images rasterized so far. It only grows when an image is requested at a new size.
+     * @return The number of images read since the start of the process.
+     */
+    static int GetRasterizationsCount(void);
+
+private: // Methods
+    /**
+     * @brief Reads an image at a given size, and rotates it.
+     * @param File The path of the image.
+     * @param Size The size it's displayed at, in logical pixels.
+     * @param AspectMode How the image fits the size.
+     * @param Angle A rotation applied after the rasterization, a multiple of 90°.
+     * @return The rasterized image. A null pixmap if the file can't be read.
+     */
+    static QPixmap Rasterize(const QString &File, const QSize &Size, const Qt::AspectRatioMode AspectMode, const int Angle);
+
+private: // Attributes
+    /**
+     * @brief The rasterized images, by file, size, aspect mode and angle.
+     */
+    inline static QHash<QString, QPixmap> _Images;
+
+    /**
+     * @brief The number of images rasterized so far.
+     */
+    inline static int _RasterizationsCount = 0;
+};
+
+#endif // RASTERATLAS_H
@@ -0,0 +1,71 @@
+/* StartupProbe.h */
+
+#ifndef STARTUPPROBE_H
+#define STARTUPPROBE_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QWidget>
+
+#include "Headers/Controller.h"
+
+/**
+ * @brief The StartupProbe class measures how long the user waits at startup.
+ *
+ * @details Two durations are measured from the start of the process, as the dictionary is loaded in the background:
+ * - The time to first frame: when the window is painted for the first time, and can take inputs.
+ * - The time to first suggestion: when the dictionary is loaded, and the suggestion tiles can be used.
+ */
+class StartupProbe : public QObject
+{
+    Q_OBJECT
+
+signals:
+    /**
+     * @brief Signal emitted once both durations are measured and printed.
+     */
+    void Finished(void);
+
+public: // Methods
+    /**
+     * @brief Constructor of the StartupProbe.
+     * @param Clock The clock started with the process.
+     * @param Window The window whose first paint is awaited.
+     * @param Target The Controller whose dictionary is awaited.
+     * @param parent The parent object.
+     */
+    StartupProbe(const QElapsedTimer &Clock, QWidget *Window, Controller *Target, QObject *parent = nullptr);
+
+protected: // Methods
+    /**
+     * @brief Catches the first paint of the window.
+     * @param Watched The window.
+     * @param Event The event received by the window.
+     * @return Always false: the event is still delivered.
+     */
+    bool eventFilter(QObject *Watched, QEvent *Event) override;
+
+private: // Methods
+    /**
+     * @brief Emits Finished() if both durations are measured.
+     */
+    void CheckFinished(void);
+
+private: // Attributes
+    /**
+     * @brief The clock started with the process.
+     */
+    QElapsedTimer _Clock;
+
+    /**
+     * @brief Nanoseconds until the first frame, -1 until measured.
+     */
+    qint64 _FirstFrame;
+
+    /**
+     * @brief Nanoseconds until the first suggestion can be displayed, -1 until measured.
+     */
+    qint64 _FirstSuggestion;
+};
+
+#endif // STARTUPPROBE_H
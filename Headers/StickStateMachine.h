@@ -0,0 +1,199 @@
+/* StickStateMachine.h */
+
+#ifndef STICKSTATEMACHINE_H
+#define STICKSTATEMACHINE_H
+
+#include <QtGlobal>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @def STICK_ENTER_RADIUS
+ * @brief The radius from which a stick at the center is considered at the border.
+ *
+ * @details It's mainly needed to compensate factory default of controllers: my own Nintend switch pro
+ * can have a Radius of 0.99 at the border for instance. A lower value than 1 is chosen to prevent unwanted types,
+ * in cases the user take the stick a bit away when moving it around the border quickly.
+ */
+#define STICK_ENTER_RADIUS 0.7
+
+/**
+ * @def STICK_EXIT_RADIUS
+ * @brief The radius under which a stick at the border is considered released.
+ *
+ * @details Lower than STICK_ENTER_RADIUS, so a stick resting around the threshold does not type a character at
+ * each flip between the center and the border.
+ */
+#define STICK_EXIT_RADIUS 0.5
+
+/**
+ * @def SECTOR_HYSTERESIS
+ * @brief The angle, in degree, the stick must go beyond the edge of the selected tile to select the neighbour tile.
+ */
+#define SECTOR_HYSTERESIS 6.0
+
+/**
+ * @def SECTOR_DWELL_TIME
+ * @brief The time, in milliseconds, a neighbour tile must be pointed before it's selected. 0 to disable.
+ *
+ * @details Only applies when sliding along the border: the first tile pointed when leaving the center is always
+ * selected immediately, or a quick flick would type the previously selected tile.
+ */
+#define SECTOR_DWELL_TIME 0
+
+/**
+ * @def SINGLE_THRESHOLD_RADIUS
+ * @brief The unique radius threshold used before the state machine. Only used to measure what the state machine
+ * suppresses.
+ */
+#define SINGLE_THRESHOLD_RADIUS 0.7
+
+/**
+ * @brief Represents what changed after an update of the stick position. The values are flags.
+ */
+enum StickEvent_t : uint8_t {
+    STICK_NO_EVENT = 0,
+    STICK_TILE_CHANGED = 1, /**< Another tile is selected. */
+    STICK_RELEASED = 2      /**< The stick left the border. */
+};
+
+/**
+ * @brief Holds the thresholds of a StickStateMachine.
+ */
+struct StickThresholds_t {
+    double EnterRadius;      /**< @see STICK_ENTER_RADIUS */
+    double ExitRadius;       /**< @see STICK_EXIT_RADIUS */
+    double SectorHysteresis; /**< @see SECTOR_HYSTERESIS */
+    qint64 DwellTime;        /**< @see SECTOR_DWELL_TIME */
+};
+
+/**
+ * @brief Counts the transitions of a stick, and the ones a single threshold logic would have done.
+ *
+ * @details The difference between the two is what the state machine suppresses.
+ */
+struct StickMetrics_t {
+    quint64 TileChanges;                /**< Tiles selected by the state machine. */
+    quint64 Releases;                   /**< Releases detected by the state machine. */
+    quint64 SingleThresholdTileChanges; /**< Tiles a single threshold logic would have selected. */
+    quint64 SingleThresholdReleases;    /**< Releases a single threshold logic would have detected. */
+    quint64 DwellRejections;            /**< Neighbour tiles pointed for less than the dwell time. */
+};
+
+/**
+ * @brief The StickStateMachine class turns the raw positions of a stick into tile selections and releases.
+ *
+ * @details A stick at the center enters the border above the enter radius, and leaves it under the exit radius. In
+ * between, the selected tile is kept: the angle is not reliable close to the center. At the border, the selected tile
+ * only changes when the stick goes beyond its edge by the sector hysteresis, and optionally when the new tile is
+ * pointed for the dwell time.
+ */
+class StickStateMachine {
+public: // Methods
+    /**
+     * @brief Constructor of the StickStateMachine.
+     * @param InitialTile The tile selected at start, DEFAULT_TILE if none.
+     * @param Thresholds The thresholds of the state machine.
+     */
+    explicit StickStateMachine(const uint8_t InitialTile = DEFAULT_TILE,
+                               const StickThresholds_t Thresholds = {STICK_ENTER_RADIUS, STICK_EXIT_RADIUS,
+                                                                     SECTOR_HYSTERESIS, SECTOR_DWELL_TIME});
+
+    /**
+     * @brief Updates the state machine with a new position of the stick.
+     * @param X The position on the X axis.
+     * @param Y The position on the Y axis.
+     * @param Timestamp The time of the update, in milliseconds. Only used for the dwell time.
+     * @return A combination of StickEvent_t flags. When both are set, the tile changed before the release.
+     */
+    uint8_t Update(const double X, const double Y, const qint64 Timestamp);
+
+    /**
+     * @brief Getter for the selected tile.
+     * @return The index of the selected tile, DEFAULT_TILE if none.
+     */
+    uint8_t GetTile(void) const;
+
+    /**
+     * @brief Unselects the tile, without emitting any event.
+     * @details Used when the tiles change under the stick, such as the inner tiles after a char group change.
+     */
+    void ResetTile(void);
+
+    /**
+     * @brief Brings the stick back to the center, without emitting any event. The selected tile is kept.
+     * @details Used when the gamepad is disconnected: its last position is meaningless and must not type anything.
+     */
+    void Center(void);
+
+    /**
+     * @brief Getter for the metrics.
+     * @return The transitions counted since the construction.
+     */
+    StickMetrics_t GetMetrics(void) const;
+
+private: // Methods
+    /**
+     * @brief Computes the tile pointed by an angle, without hysteresis.
+     * @param Angle The angle of the stick, in degree.
+     * @return The index of the tile.
+     */
+    static uint8_t SectorOf(const double Angle);
+
+    /**
+     * @brief Computes the tile to select at the border, with hysteresis around the edges of the selected tile.
+     * @param Angle The angle of the stick, in degree.
+     * @return The index of the tile to select.
+     */
+    uint8_t HystereticSectorOf(const double Angle) const;
+
+    /**
+     * @brief Updates the metrics of the single threshold logic.
+     * @param Radius The radius of the stick.
+     * @param Angle The angle of the stick, in degree.
+     */
+    void UpdateSingleThresholdMetrics(const double Radius, const double Angle);
+
+private: // Attributes
+    /**
+     * @brief The thresholds of the state machine.
+     */
+    StickThresholds_t _Thresholds;
+
+    /**
+     * @brief CENTER or BORDER.
+     */
+    StickPosition_t _Position;
+
+    /**
+     * @brief The selected tile, DEFAULT_TILE if none.
+     */
+    uint8_t _Tile;
+
+    /**
+     * @brief The neighbour tile waiting for the dwell time, DEFAULT_TILE if none.
+     */
+    uint8_t _PendingTile;
+
+    /**
+     * @brief When the pending tile started to be pointed.
+     */
+    qint64 _PendingSince;
+
+    /**
+     * @brief The position of the stick for the single threshold logic.
+     */
+    StickPosition_t _SingleThresholdPosition;
+
+    /**
+     * @brief The selected tile for the single threshold logic.
+     */
+    uint8_t _SingleThresholdTile;
+
+    /**
+     * @brief The transitions counted since the construction.
+     */
+    StickMetrics_t _Metrics;
+};
+
+#endif // STICKSTATEMACHINE_H
@@ -0,0 +1,98 @@
+/* SwipeDecoder.h */
+
+#ifndef SWIPEDECODER_H
+#define SWIPEDECODER_H
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+#include "Headers/Trie.h"
+
+/**
+ * @def SWIPE_BEAM_WIDTH
+ * @brief The number of partial words kept at each letter of the decoding.
+ *
+ * @details The partial words are ranked by the most frequent word they can still become. The width bounds the
+ * decoding time whatever the size of the dictionary.
+ */
+#define SWIPE_BEAM_WIDTH 128
+
+/**
+ * @def SWIPE_MAX_CANDIDATES
+ * @brief The number of ranked words returned by a decoding.
+ */
+#define SWIPE_MAX_CANDIDATES MAX_SUGGESTIONS
+
+/**
+ * @brief Represents a tile visited by the right stick during a swipe.
+ */
+struct SwipeKey_t {
+    uint8_t Group; /**< The char group selected by the left stick. */
+    uint8_t Tile;  /**< The tile pointed by the right stick. */
+
+    bool operator==(const SwipeKey_t &Other) const { return Group == Other.Group && Tile == Other.Tile; }
+};
+
+/**
+ * @brief Counts the swipes of a session and the time spent decoding them.
+ */
+struct SwipeStats_t {
+    quint64 Swipes;        /**< Swipes ended, decoded or not. */
+    quint64 Words;         /**< Swipes that typed a word. */
+    quint64 Keys;          /**< Tiles visited by all the swipes. */
+    qint64 DecodeTime;     /**< Nanoseconds spent decoding. */
+    qint64 MaxDecodeTime;  /**< Nanoseconds spent by the slowest decoding. */
+};
+
+/**
+ * @brief The SwipeDecoder class turns the tiles visited by a swipe into ranked words of the dictionary.
+ *
+ * @details A word matches a swipe when the tiles of its letters, in order, are a subsequence of the visited tiles
+ * starting at the first one and ending at the last one: the tiles crossed between two letters are skipped, and a
+ * double letter is a single visit. The first tile visited after a change of char group can't be skipped. The Trie
+ * is walked letter by letter, keeping only the SWIPE_BEAM_WIDTH partial words that can still become the most frequent
+ * words, and the complete words are ranked by frequency.
+ */
+class SwipeDecoder {
+public: // Methods
+    /**
+     * @brief Constructor of the SwipeDecoder.
+     * @param Dictionary The Trie to decode against, shared with the other sessions. Null if not loaded yet.
+     */
+    explicit SwipeDecoder(const QSharedPointer<const Trie> &Dictionary = QSharedPointer<const Trie>());
+
+    /**
+     * @brief Setter for the dictionary, once loaded.
+     * @param Dictionary The Trie to decode against, shared with the other sessions.
+     */
+    void SetDictionary(const QSharedPointer<const Trie> &Dictionary);
+
+    /**
+     * @brief Reads the tiles of the characters from the active KeyboardLayout, once it changed.
+     */
+    void ReloadKeys(void);
+
+    /**
+     * @brief Decodes a swipe.
+     * @param Path The tiles visited, without consecutive duplicates.
+     * @param Prefix The beginning of the word already typed, the swipe completing it.
+     * @return At most SWIPE_MAX_CANDIDATES full words, the most frequent first. Empty if none matches, or if the
+     * dictionary is not loaded yet.
+     */
+    QVector<QString> Decode(const QVector<SwipeKey_t> &Path, const QString &Prefix = "") const;
+
+private: // Attributes
+    /**
+     * @brief The Trie to decode against.
+     */
+    QSharedPointer<const Trie> _Trie;
+
+    /**
+     * @brief The tile of each character that can be swiped, from the active KeyboardLayout.
+     */
+    QHash<QChar, SwipeKey_t> _Keys;
+};
+
+#endif // SWIPEDECODER_H
@@ -0,0 +1,78 @@
+/* TextBuffer.h */
+
+#ifndef TEXTBUFFER_H
+#define TEXTBUFFER_H
+
+#include <QObject>
+#include <QString>
+
+/**
+ * @brief The TextBuffer class is the text field of the frontends without widgets, such as the simulator.
+ *
+ * @details It applies the outputs of a Controller, TypeToTextField and SendOrderToTextField, to a QString and a cursor,
+ * the way the text field widgets do: a backspace deletes a whole character, an emote included, and the arrows move
+ * over it.
+ */
+class TextBuffer : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    /**
+     * @brief Types a text at the cursor.
+     * @param Text The text to type.
+     */
+    void InsertText(const QString &Text);
+
+    /**
+     * @brief Handle the special instructions like backspace or others related button features
+     * @param Key They key associated to the action to perform.
+     * @see GP4k_ButtonsMapping.h
+     */
+    void OrderReceived(const Qt::Key Key);
+
+public: // Methods
+    /**
+     * @brief Constructor of an empty TextBuffer.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit TextBuffer(QObject *parent = nullptr);
+
+    /**
+     * @brief Getter for the text.
+     * @return The text typed so far.
+     */
+    QString Text(void) const;
+
+    /**
+     * @brief Getter for the cursor.
+     * @return The position of the cursor, in UTF-16 units.
+     */
+    int Cursor(void) const;
+
+    /**
+     * @brief Empties the text.
+     */
+    void Clear(void);
+
+private: // Methods
+    /**
+     * @brief Finds the character boundary next to the cursor.
+     * @param Forward True for the boundary after the cursor, false for the one before.
+     * @return The position of the boundary, the cursor itself at the ends of the text.
+     */
+    int NextBoundary(const bool Forward) const;
+
+private: // Attributes
+    /**
+     * @brief The text typed so far.
+     */
+    QString _Text;
+
+    /**
+     * @brief The position of the cursor, in UTF-16 units.
+     */
+    int _Cursor;
+};
+
+#endif // TEXTBUFFER_H
@@ -0,0 +1,74 @@
+/* TileBackgroundCache.h */
+
+#ifndef TILEBACKGROUNDCACHE_H
+#define TILEBACKGROUNDCACHE_H
+
+#include <QPixmap>
+#include <QString>
+#include <QVector>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @brief Represents the possible backgrounds of a tile.
+ */
+enum TileState_t : uint8_t {
+    TILE_NORMAL,
+    TILE_SELECTED,
+    TILE_UNAVAILABLE,
+    NUMBER_OF_TILE_STATES
+};
+
+/**
+ * @brief The TileBackgroundCache class holds the backgrounds of every tile, rasterized once for the whole process.
+ *
+ * @details Each variant (inner/outer × axes/diag × normal/selected/unavailable × rotation) is taken from the
+ * RasterAtlas at the size of its tile for the GuiScale, the first time a background is requested. A change of state
+ * then only swaps an implicitly shared QPixmap, without even a lookup in the atlas. The cache lives in the GUI
+ * thread, as QPixmap does.
+ */
+class TileBackgroundCache {
+public: // Methods
+    /**
+     * @brief Getter for the background of a tile.
+     * @param Radius The tile group of the tile.
+     * @param Index The index of the tile in its group.
+     * @param State The state of the tile.
+     * @return The rasterized background, rotated for the tile.
+     */
+    static const QPixmap& Get(const radius_t Radius, const uint8_t Index, const TileState_t State);
+
+    /**
+     * @brief Counts the SVG rasterized so far by the RasterAtlas. The backgrounds don't make it grow after the first
+     * request.
+     * @return The number of SVG read since the start of the process.
+     */
+    static int GetRasterizationsCount(void);
+
+private: // Methods
+    /**
+     * @brief Builds the path of the SVG of a background.
+     * @param Radius The tile group of the tile.
+     * @param Index The index of the tile in its group.
+     * @param State The state of the tile.
+     * @return The path in the resources.
+     */
+    static QString BackgroundFile(const radius_t Radius, const uint8_t Index, const TileState_t State);
+
+    /**
+     * @brief Gets an SVG from the RasterAtlas at the size of a tile, rotated.
+     * @param File The path of the SVG.
+     * @param Radius The tile group of the tile.
+     * @param Index The index of the tile in its group.
+     * @return The background, a null pixmap if the file doesn't exist.
+     */
+    static QPixmap Rasterize(const QString &File, const radius_t Radius, const uint8_t Index);
+
+    /**
+     * @brief Rasterizes every variant, at the first request.
+     * @return The backgrounds, indexed with [radius_t][Index][TileState_t].
+     */
+    static const QVector<QVector<QVector<QPixmap>>>& Backgrounds(void);
+};
+
+#endif // TILEBACKGROUNDCACHE_H
@@ -0,0 +1,201 @@
+/* Trace.h */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstdint>
+
+#include <QString>
+
+/**
+ * @def TRACE_OFF
+ * @brief Trace level recording nothing: every trace macro compiles to nothing.
+ */
+#define TRACE_OFF 0
+
+/**
+ * @def TRACE_EVENTS
+ * @brief Trace level recording the handling of each gamepad event and the loading of the dictionary.
+ */
+#define TRACE_EVENTS 1
+
+/**
+ * @def TRACE_DETAIL
+ * @brief Trace level also recording the queries of the dictionary and the updates of the widgets.
+ */
+#define TRACE_DETAIL 2
+
+/**
+ * @def GP4K_TRACE_LEVEL
+ * @brief The most detailed level compiled in, TRACE_OFF by default. Set it with qmake "GP4K_TRACE_LEVEL=2".
+ */
+#ifndef GP4K_TRACE_LEVEL
+#define GP4K_TRACE_LEVEL TRACE_OFF
+#endif
+
+/**
+ * @def TRACE_RING_SIZE
+ * @brief The number of events kept per thread. The oldest ones are overwritten. Must be a power of 2.
+ */
+#define TRACE_RING_SIZE 16384U
+
+/**
+ * @brief Represents the kinds of events in a trace, as the Chrome trace phases.
+ */
+enum TraceEventType_t : uint8_t {
+    TRACE_SPAN,     /**< A duration, "X" phase. */
+    TRACE_INSTANT   /**< A point in time, "i" phase. */
+};
+
+/**
+ * @brief A fixed-size trace event. The name must be a string literal: it's stored as a pointer.
+ */
+struct TraceEvent_t {
+    const char *Name;       /**< What happened. */
+    int64_t Start;          /**< Nanoseconds since the start of the process. */
+    int64_t Duration;       /**< Nanoseconds, 0 for an instant. */
+    TraceEventType_t Type;  /**< Span or instant. */
+};
+
+/**
+ * @brief A slot of a TraceRing: an event and the sequence number telling which one it holds.
+ *
+ * @details The fields are relaxed atomics, so the export reading a slot while its thread rewrites it is not a data
+ * race: the sequence number tells the copy is torn.
+ */
+struct TraceSlot_t {
+    std::atomic<uint64_t> Sequence;         /**< 2 * (index + 1) once event index is written, odd while writing. */
+    std::atomic<const char*> Name;          /**< TraceEvent_t::Name. */
+    std::atomic<int64_t> Start;             /**< TraceEvent_t::Start. */
+    std::atomic<int64_t> Duration;          /**< TraceEvent_t::Duration. */
+    std::atomic<TraceEventType_t> Type;     /**< TraceEvent_t::Type. */
+};
+
+/**
+ * @brief The TraceRing class holds the last events of a single thread.
+ *
+ * @details Only the owning thread writes, so recording an event is a few relaxed stores between two stores of the
+ * sequence number of its slot: no lock, no allocation. The export checks the sequence number before and after
+ * copying a slot, and drops the slots rewritten meanwhile.
+ */
+class TraceRing {
+public: // Methods
+    /**
+     * @brief Constructor of the TraceRing.
+     * @param ThreadId The id of the owning thread in the trace.
+     */
+    explicit TraceRing(const int ThreadId);
+
+    /**
+     * @brief Records an event. Only called by the owning thread.
+     * @param Event The event.
+     */
+    void Push(const TraceEvent_t &Event);
+
+    /**
+     * @brief Appends the events still in the ring to a Chrome trace.
+     * @param Json The "traceEvents" array being written, without its brackets.
+     * @param IsFirst True while no event has been written in the array. Updated.
+     */
+    void AppendChromeEvents(QString &Json, bool &IsFirst) const;
+
+private: // Attributes
+    /**
+     * @brief The id of the owning thread in the trace.
+     */
+    const int _ThreadId;
+
+    /**
+     * @brief The number of events recorded since the creation. The next slot is _Written % TRACE_RING_SIZE.
+     */
+    std::atomic<uint64_t> _Written;
+
+    /**
+     * @brief The events.
+     */
+    TraceSlot_t _Slots[TRACE_RING_SIZE];
+};
+
+/**
+ * @brief The Trace class records timed events of every thread, and exports them as a Chrome trace.
+ *
+ * @details Each thread records in its own TraceRing, created at its first event. The rings outlive their threads, so
+ * the events of a finished worker are still exported. The file can be opened with chrome://tracing or
+ * ui.perfetto.dev. Use the GP4K_TRACE_* macros rather than the class: they compile to nothing when their level is
+ * above GP4K_TRACE_LEVEL, so they can stay in production builds.
+ */
+class Trace {
+public: // Methods
+    /**
+     * @brief Records an event in the ring of the calling thread.
+     * @param Type Span or instant.
+     * @param Name What happened, a string literal.
+     * @param Start Nanoseconds since the start of the process.
+     * @param Duration Nanoseconds, 0 for an instant.
+     */
+    static void Record(const TraceEventType_t Type, const char *Name, const int64_t Start, const int64_t Duration);
+
+    /**
+     * @brief Getter for the time.
+     * @return Nanoseconds since the start of the process, from a monotonic clock.
+     */
+    static int64_t Now(void);
+
+    /**
+     * @brief Writes the events of every thread in the Chrome trace event format.
+     * @param FilePath The JSON file to write.
+     * @return True if the file has been written, false else. Without tracing compiled in, the trace is empty.
+     */
+    static bool ExportChromeJson(const QString &FilePath);
+};
+
+/**
+ * @brief Records a span from its construction to its destruction.
+ * @tparam Enabled False when the level of the span is not compiled in: the object is then empty.
+ */
+template<bool Enabled>
+class TraceSpan {
+public:
+    explicit TraceSpan(const char *Name) : _Name(Name), _Start(Trace::Now()) {}
+    ~TraceSpan() { Trace::Record(TRACE_SPAN, _Name, _Start, Trace::Now() - _Start); }
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char *_Name;   /**< What the span covers, a string literal. */
+    const int64_t _Start; /**< Nanoseconds since the start of the process. */
+};
+
+template<>
+class TraceSpan<false> {
+public:
+    explicit TraceSpan(const char *) {}
+};
+
+#define GP4K_TRACE_CONCAT_INNER(A, B) A##B
+#define GP4K_TRACE_CONCAT(A, B) GP4K_TRACE_CONCAT_INNER(A, B)
+
+/**
+ * @def GP4K_TRACE_SPAN
+ * @brief Records the duration of the rest of the enclosing scope.
+ * @param Level TRACE_EVENTS or TRACE_DETAIL.
+ * @param Name A string literal.
+ */
+/**
+ * @def GP4K_TRACE_INSTANT
+ * @brief Records a point in time.
+ * @param Level TRACE_EVENTS or TRACE_DETAIL.
+ * @param Name A string literal.
+ */
+#if GP4K_TRACE_LEVEL > TRACE_OFF
+#define GP4K_TRACE_SPAN(Level, Name) \
+    const TraceSpan<((Level) <= GP4K_TRACE_LEVEL)> GP4K_TRACE_CONCAT(_TraceSpan, __LINE__)(Name)
+#define GP4K_TRACE_INSTANT(Level, Name) \
+    do { if((Level) <= GP4K_TRACE_LEVEL){ Trace::Record(TRACE_INSTANT, (Name), Trace::Now(), 0); } } while(0)
+#else
+#define GP4K_TRACE_SPAN(Level, Name)
+#define GP4K_TRACE_INSTANT(Level, Name) do {} while(0)
+#endif
+
+#endif // TRACE_H
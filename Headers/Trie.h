@@ -5,11 +5,19 @@
 
 #include "Headers/GP4k_TilesMapping.h"
 #include <QString>
+#include <QFuture>
 #include <QMap>
+#include <QSharedPointer>
 #include <QStringList>
 
 #define MAX_SUGGESTIONS 3
 
+/**
+ * @def UNRANKED
+ * @brief The rank of a node no word ends or passes through yet.
+ */
+#define UNRANKED 0xFFFFFFFFU
+
 /**
  * @brief The TrieNode class is a class used by the Trie to represent a direction/letter.
  */
@@ -25,6 +33,18 @@ public:
      */
     bool _IsEndOfWord;
 
+    /**
+     * @brief The rank of the word ending at this node, UNRANKED if none.
+     * @details Words are ranked in the order of the words list, which is sorted by frequency: 0 is the most frequent.
+     */
+    quint32 _WordRank;
+
+    /**
+     * @brief The rank of the most frequent word starting with the letters leading to this node.
+     * @details Lets a search rank a partial word by the best word it can still become.
+     */
+    quint32 _BestRank;
+
     /**
      * @brief Constructor for the TrieNode class.
      */
@@ -39,19 +59,51 @@ public:
 /**
  * @brief A trie is a tool used to organize words in a tree, in which the branch (called nodes) represents the different
  * possible letters from the previous one.
+ *
+ * @details Once built, a Trie is only read through its const methods, which don't modify any node: any number of
+ * threads can query the same instance without locking. This is how the sessions of several gamepads share one
+ * dictionary, see Shared().
  */
 class Trie {
 public:
     /**
-     * @brief Constructor for the Trie class.
+     * @brief Constructor for the Trie class, from the bundled words list.
      */
     Trie();
 
+    /**
+     * @brief Constructor for the Trie class, from another words list such as the one of gp4k-ngram --word-list.
+     * @param WordListPath The file holding a word per line, the most frequent first. If it can't be read, the Trie is
+     * empty: see IsLoaded.
+     */
+    explicit Trie(const QString &WordListPath);
+
     /**
      * @brief Destructor for the Trie class.
      */
     ~Trie();
 
+    /**
+     * @brief Tells if the words list was read.
+     * @return False if it couldn't be opened: the Trie is then empty, and the callers measuring or serving it abort.
+     */
+    bool IsLoaded(void) const;
+
+    /**
+     * @brief Getter for the dictionary shared by every Autocomplete of the application.
+     * @return The shared Trie, built at the first call.
+     *
+     * @details The Trie is built once whatever the number of sessions, so the memory doesn't grow with them. It's
+     * only reachable as const, and stays alive as long as a session or a background query holds it.
+     */
+    static QSharedPointer<const Trie> Shared(void);
+
+    /**
+     * @brief Builds the shared dictionary on a worker thread.
+     * @return The future of Shared(). The building starts at the first call, the next ones return the same future.
+     */
+    static QFuture<QSharedPointer<const Trie>> SharedAsync(void);
+
     /**
      * @brief Insert a word in the Trie.
      * @param Word the word to insert.
@@ -77,7 +129,7 @@ public:
      * It prevents using a suggestion slot for a word requiring the same effort to reach the letter.
      * or the suggestion tile.
      */
-    QVector<QString> Suggest(const QString &Prefix, const CharGroup_t SkipLastChar) const;
+    QVector<QString> Suggest(const QString &Prefix, const CharGroup_t &SkipLastChar) const;
 
     /**
      * @brief Search a word and insert it in the node if not already present.
@@ -86,12 +138,28 @@ public:
      */
     bool SearchAndInsert(const QString &Word);
 
+    /**
+     * @brief Getter for the root node, to walk the Trie with another strategy than Suggest.
+     * @return The root node, only readable.
+     */
+    const TrieNode* GetRoot(void) const;
+
 private: // Attributes
     /**
      * @brief _Root The root node of the Trie
      */
     TrieNode *_Root;
 
+    /**
+     * @brief The number of words inserted so far: the rank of the next one.
+     */
+    quint32 _WordsCount;
+
+    /**
+     * @brief False if the words list couldn't be opened.
+     */
+    bool _IsLoaded;
+
 private: // Methods
     /**
      * @brief A function used by the method `Suggest` to isolate its recursive part.
@@ -0,0 +1,120 @@
+/* TypingStats.h */
+
+#ifndef TYPINGSTATS_H
+#define TYPINGSTATS_H
+
+#include <array>
+
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+/**
+ * @def STATS_LETTERS
+ * @brief The letters counted, from 'a' to 'z': those gp4k-layout-optimizer places.
+ */
+#define STATS_LETTERS 26
+
+/**
+ * @def STATS_FLUSH_INTERVAL_MS
+ * @brief Delay between two writes of the statistics file, when new letters were typed.
+ */
+#define STATS_FLUSH_INTERVAL_MS 60000
+
+/**
+ * @brief The TypingStats class counts the letters and the bigrams the user types, for a personal layout.
+ *
+ * @details Only the counts are kept, never the text: STATS_LETTERS letters and STATS_LETTERS² bigrams, case folded,
+ * so the memory used doesn't grow with the sessions. A character that isn't a letter, a space or a key such as the
+ * backspace ends the current word: no bigram spans it. Only the chars typed one by one are counted, see
+ * Controller::CharTyped, not the accepted suggestions nor the swiped words.
+ *
+ * The counts are stored in the format of count_2l.txt, a letter or a bigram and its count separated by a tab on each
+ * line, so the file can be given as is to gp4k-layout-optimizer --personal. The counts already in the file are added
+ * to at construction, and the file is rewritten atomically every STATS_FLUSH_INTERVAL_MS when something was typed,
+ * then on destruction. Several sessions can share a TypingStats: each one has its current word.
+ */
+class TypingStats : public QObject
+{
+    Q_OBJECT
+
+public: // Methods
+    /**
+     * @brief Constructor of the TypingStats. Loads the counts of the file, if it exists.
+     * @param Path The statistics file.
+     * @param parent Pointer to the parent object (optional).
+     */
+    explicit TypingStats(const QString &Path, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor of the TypingStats. Writes the counts not saved yet.
+     */
+    ~TypingStats() override;
+
+    /**
+     * @brief Writes the counts to the file, replacing it at once.
+     * @return False if the file can't be written.
+     */
+    bool Save(void);
+
+    /**
+     * @brief Getter for the letters counted, those of the file included.
+     * @return The sum of the letter counts.
+     */
+    quint64 Letters(void) const;
+
+    /**
+     * @brief Counts the letters and bigrams of a text typed.
+     * @param Source The session typing, whose current word the text continues.
+     * @param Text The text, as emitted by Controller::CharTyped.
+     */
+    void RecordText(const QObject *Source, const QString &Text);
+
+    /**
+     * @brief Ends the current word of a session, for the keys that don't type text.
+     * @param Source The session.
+     * @param Key The key, as emitted by Controller::SendOrderToTextField.
+     */
+    void RecordKey(const QObject *Source, const Qt::Key Key);
+
+private: // Methods
+    /**
+     * @brief Adds the counts of the file to the current ones.
+     * @return False if the file exists and can't be read.
+     */
+    bool Load(void);
+
+private: // Attributes
+    /**
+     * @brief The statistics file.
+     */
+    QString _Path;
+
+    /**
+     * @brief The count of each letter, by index from 'a'.
+     */
+    std::array<quint64, STATS_LETTERS> _LetterCounts;
+
+    /**
+     * @brief The count of each bigram, [First * STATS_LETTERS + Second].
+     */
+    std::array<quint64, STATS_LETTERS * STATS_LETTERS> _BigramCounts;
+
+    /**
+     * @brief The index of the previous letter typed by each session, -1 or absent at the start of a word.
+     */
+    QHash<const QObject*, int> _Previous;
+
+    /**
+     * @brief Whether counts were added since the last write.
+     */
+    bool _Dirty;
+
+    /**
+     * @brief Writes the counts periodically.
+     */
+    QTimer _FlushTimer;
+};
+
+#endif // TYPINGSTATS_H
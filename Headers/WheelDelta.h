@@ -0,0 +1,124 @@
+/* WheelDelta.h */
+
+#ifndef WHEELDELTA_H
+#define WHEELDELTA_H
+
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+#include "Headers/GP4k_Typedefs.h"
+
+/**
+ * @brief Represents the parts of the wheel a WheelDelta changes. The values are flags.
+ */
+enum WheelDeltaField_t : uint8_t {
+    DELTA_NOTHING = 0,
+    DELTA_OUTER_SELECTED = 1,   /**< Another outer tile is selected. */
+    DELTA_INNER_RESET = 2,      /**< All the inner tiles are made available and unselected. */
+    DELTA_INNER_SELECTED = 4,   /**< Another inner tile is selected. */
+    DELTA_OUTER_TEXTS = 8,      /**< The outer tiles display the texts of another shift state. */
+    DELTA_INNER_TEXTS = 16,     /**< The inner tiles display the chars of another group or shift state. */
+    DELTA_SUGGESTIONS = 32      /**< Some suggestion tiles display other suggestions. */
+};
+
+/**
+ * @brief The WheelDelta class gathers all the changes of the wheel caused by a single input event.
+ *
+ * @details The Controller fills one WheelDelta while handling an event, then sends it once. The receiver applies the
+ * changes in a fixed order: outer selection, inner reset, inner selection, texts, suggestions. A reset also unselects
+ * the inner tile, so recording it after an inner selection gives the same result as the former signal sequence.
+ */
+class WheelDelta {
+public: // Methods
+    /**
+     * @brief Constructor of an empty WheelDelta.
+     */
+    WheelDelta();
+
+    /**
+     * @brief Records the selection of an outer tile.
+     * @param Tile The index of the tile, DEFAULT_TILE for none.
+     */
+    void SelectOuterTile(const uint8_t Tile);
+
+    /**
+     * @brief Records the reset of the inner tiles.
+     */
+    void ResetInnerTiles(void);
+
+    /**
+     * @brief Records the selection of an inner tile.
+     * @param Tile The index of the tile, DEFAULT_TILE for none.
+     */
+    void SelectInnerTile(const uint8_t Tile);
+
+    /**
+     * @brief Records a change of the texts of the outer tiles.
+     * @param Shift The shift state of the texts.
+     */
+    void SetOuterTexts(const ShiftState_t Shift);
+
+    /**
+     * @brief Records a change of the chars of the inner tiles.
+     * @param Shift The shift state of the chars.
+     * @param CharGroup The char group to display.
+     */
+    void SetInnerTexts(const ShiftState_t Shift, const uint8_t CharGroup);
+
+    /**
+     * @brief Records a change of a suggestion tile. A later change of the same tile replaces it.
+     * @param Tile The index of the suggestion tile.
+     * @param Suggestion The suggestion to display, "" if none.
+     */
+    void SetSuggestion(const uint8_t Tile, const QString &Suggestion);
+
+    /**
+     * @brief Tells if anything changed.
+     * @return True if no change has been recorded.
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * @brief Forgets all the recorded changes.
+     */
+    void Clear(void);
+
+public: // Attributes
+    /**
+     * @brief The changed parts, a combination of WheelDeltaField_t flags.
+     */
+    uint8_t Fields;
+
+    /**
+     * @brief The selected outer tile, if DELTA_OUTER_SELECTED.
+     */
+    uint8_t OuterSelectedTile;
+
+    /**
+     * @brief The selected inner tile, if DELTA_INNER_SELECTED.
+     */
+    uint8_t InnerSelectedTile;
+
+    /**
+     * @brief The shift state of the outer texts, if DELTA_OUTER_TEXTS.
+     */
+    ShiftState_t OuterShift;
+
+    /**
+     * @brief The shift state of the inner chars, if DELTA_INNER_TEXTS.
+     */
+    ShiftState_t InnerShift;
+
+    /**
+     * @brief The char group of the inner chars, if DELTA_INNER_TEXTS.
+     */
+    uint8_t CharGroup;
+
+    /**
+     * @brief The changed suggestion tiles and their suggestion, if DELTA_SUGGESTIONS.
+     */
+    QVector<QPair<uint8_t, QString>> Suggestions;
+};
+
+#endif // WHEELDELTA_H
@@ -0,0 +1,92 @@
+/* WheelViewModel.h */
+
+#ifndef WHEELVIEWMODEL_H
+#define WHEELVIEWMODEL_H
+
+#include <QString>
+#include <QVector>
+
+#include "Headers/GP4k_Typedefs.h"
+#include "Headers/WheelDelta.h"
+
+/**
+ * @brief Counts the changes a WheelViewModel received and the ones it let through.
+ */
+struct ViewModelStats_t {
+    quint64 RequestedDeltas;   /**< Deltas received, empty or not. */
+    quint64 PublishedDeltas;   /**< Deltas that still held a change once diffed. */
+    quint64 PublishedFields;   /**< Changes published, each suggestion tile counting for one. */
+    quint64 SuppressedFields;  /**< Changes dropped because the wheel already displayed them. */
+};
+
+/**
+ * @brief The WheelViewModel class keeps the state of the wheel last published to the widgets, and removes from the
+ * next deltas what wouldn't change it.
+ *
+ * @details The Controller records what an event requires, such as the unshifted texts after each typed char, or the
+ * suggestions of the buffer after each query, without knowing what the wheel already displays. The view model
+ * applies each field in the order of WheelDelta to its copy of the wheel, and keeps only the fields that modified it.
+ * Its initial state is the one of a new WheelWidget.
+ */
+class WheelViewModel {
+public: // Methods
+    /**
+     * @brief Constructor of the WheelViewModel, matching a new WheelWidget.
+     */
+    WheelViewModel();
+
+    /**
+     * @brief Computes the part of a delta that changes the published state, and publishes it.
+     * @param Requested The changes required by an event.
+     * @return The changes to send to the widgets. Empty if the wheel already displays everything requested.
+     */
+    WheelDelta Diff(const WheelDelta &Requested);
+
+    /**
+     * @brief Forgets the texts published, so the next ones are sent even if they look unchanged.
+     *
+     * @details Called when the KeyboardLayout changes: the same shift state and char group then have other texts.
+     */
+    void InvalidateTexts(void);
+
+    /**
+     * @brief Getter for the counters of the view model.
+     * @return The counters since the construction.
+     */
+    ViewModelStats_t GetStats(void) const;
+
+private: // Attributes
+    /**
+     * @brief The selected tile of each group, DEFAULT_TILE if none.
+     *
+     * 2*1 QVector, Indexed with [radius_t].
+     */
+    QVector<uint8_t> _SelectedTiles;
+
+    /**
+     * @brief The shift state of the texts of the outer tiles and of the guides.
+     */
+    ShiftState_t _OuterShift;
+
+    /**
+     * @brief True if the texts of the outer tiles must be published whatever their shift state.
+     */
+    bool _OuterTextsStale;
+
+    /**
+     * @brief The text of each inner tile, char or suggestion.
+     */
+    QVector<QString> _InnerTexts;
+
+    /**
+     * @brief The availability of each inner tile.
+     */
+    QVector<bool> _InnerAvailable;
+
+    /**
+     * @brief The counters of the view model.
+     */
+    ViewModelStats_t _Stats;
+};
+
+#endif // WHEELVIEWMODEL_H
@@ -0,0 +1,166 @@
+/* WheelWidget.h */
+
+#ifndef WHEELWIDGET_H
+#define WHEELWIDGET_H
+
+#include <QPaintEvent>
+#include <QVector>
+#include <QWidget>
+
+#include "Headers/GP4k_TilesMapping.h"
+#include "Headers/GP4k_Typedefs.h"
+#include "Headers/TileBackgroundCache.h"
+#include "Headers/WheelDelta.h"
+
+/**
+ * @brief Holds what a tile of the wheel displays.
+ */
+struct WheelTile_t {
+    QString Text;       /**< The character, group or suggestion written on the tile. */
+    bool IsAvailable;   /**< False if there is nothing to select on the tile. */
+};
+
+/**
+ * @brief Counts the work done by a WheelWidget.
+ */
+struct WheelStats_t {
+    quint64 SlotCalls;  /**< Slots invoked, a whole WheelDelta being a single call. */
+    quint64 Repaints;   /**< Paint events handled. */
+};
+
+/**
+ * @brief The WheelWidget class draws the outer and the inner tile groups.
+ *
+ * @details Both rings are painted by a single paintEvent from a small model: the selected tile of each ring, and the
+ * text and availability of each tile. The backgrounds come from the TileBackgroundCache. ApplyDelta only invalidates the
+ * tiles whose content changed, and a repaint only draws the tiles intersecting the invalidated region, in the same
+ * order as the former tile widgets so the overlapping corners are identical.
+ *
+ * The Controller sends all the changes of an event as a single WheelDelta: ApplyDelta gathers the tiles they
+ * invalidate into one region, and requests one repaint of it.
+ */
+class WheelWidget : public QWidget
+{
+    Q_OBJECT
+public: // Methods
+    /**
+     * @brief WheelWidget Constructor.
+     * @param parent Pointer to the parent widget (optional).
+     */
+    explicit WheelWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief SetGeometryOnGrid place the widget in the window using the grid map instead of the pixel map.
+     * @param WidgetPlacement The placement of the outer tile group. The inner one is placed from Placements.
+     */
+    void SetGeometryOnGrid(const placement_t WidgetPlacement);
+
+    /**
+     * @brief Getter for the counters of the widget.
+     * @return The counters since the construction.
+     */
+    WheelStats_t GetStats(void) const;
+
+public slots:
+    /**
+     * @brief Applies all the changes of an event, then requests a single repaint of the changed tiles.
+     * @param Delta The changes, applied in the order documented by WheelDelta.
+     */
+    void ApplyDelta(const WheelDelta &Delta);
+
+protected: // Methods
+    /**
+     * @brief Draws the tiles intersecting the invalidated region.
+     * @param Event The paint event, holding the invalidated region.
+     */
+    void paintEvent(QPaintEvent *Event) override;
+
+private: // Methods
+    /**
+     * @brief Computes where a tile is drawn.
+     * @param Radius The group of the tile.
+     * @param Index The index of the tile in its group.
+     * @return The rectangle of the tile, in the widget coordinates.
+     */
+    QRect TileRect(const radius_t Radius, const uint8_t Index) const;
+
+    /**
+     * @brief Computes the background of a tile from the model.
+     * @param Radius The group of the tile.
+     * @param Index The index of the tile in its group.
+     * @return The state of the tile.
+     */
+    TileState_t StateOf(const radius_t Radius, const uint8_t Index) const;
+
+    /**
+     * @brief Changes the text of a tile, and invalidates it if it changed.
+     * @param Radius The group of the tile.
+     * @param Index The index of the tile in its group.
+     * @param Text The text to display.
+     */
+    void SetText(const radius_t Radius, const uint8_t Index, const QString &Text);
+
+    /**
+     * @brief Changes the texts of the first tiles of a group.
+     * @param Radius The group of the tiles.
+     * @param Texts The texts to display, from the first tile.
+     */
+    void SetTexts(const radius_t Radius, const CharGroup_t &Texts);
+
+    /**
+     * @brief Changes the selected tile of a group, and invalidates both tiles if it changed.
+     * @param Radius The group.
+     * @param TileIndex The index of the tile to select, DEFAULT_TILE for none.
+     */
+    void SetSelected(const radius_t Radius, const uint8_t TileIndex);
+
+    /**
+     * @brief Changes the availability of an inner tile, and invalidates it if it changed.
+     * @param TileIndex The index of the tile.
+     * @param IsAvailable The expected availability.
+     */
+    void SetAvailability(const uint8_t TileIndex, const bool IsAvailable);
+
+    /**
+     * @brief Makes all the tiles of the inner group available.
+     */
+    void SetAllAvailable(void);
+
+    /**
+     * @brief Marks a tile to be repainted once the delta being applied is complete.
+     * @param Rect The rectangle of the tile.
+     */
+    void Invalidate(const QRect &Rect);
+
+private: // Attributes
+    /**
+     * @brief What each tile displays.
+     *
+     * 2*8 QVector, Indexed with [radius_t][Index].
+     */
+    QVector<QVector<WheelTile_t>> _Tiles;
+
+    /**
+     * @brief The selected tile of each group, DEFAULT_TILE if none.
+     *
+     * 2*1 QVector, Indexed with [radius_t].
+     */
+    QVector<uint8_t> _SelectedTiles;
+
+    /**
+     * @brief The position of the inner group, in the widget coordinates.
+     */
+    QPoint _InnerOrigin;
+
+    /**
+     * @brief The tiles invalidated by the delta being applied.
+     */
+    QRegion _Dirty;
+
+    /**
+     * @brief The counters of the widget.
+     */
+    WheelStats_t _Stats;
+};
+
+#endif // WHEELWIDGET_H
@@ -4,6 +4,14 @@
 #include <QLabel>
 #include <QMainWindow>
 #include <QTextEdit>
+#include <QVector>
+
+#include "Headers/Controller.h"
+#include "Headers/GuideWidget.h"
+#include "Headers/ImageWidget.h"
+#include "Headers/PlainTextFieldWidget.h"
+#include "Headers/TextFieldWidget.h"
+#include "Headers/WheelWidget.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -14,8 +22,8 @@ QT_END_NAMESPACE
 /**
  * @brief The default MainWindow class
  *
- * This class represents the main application window. It contains two
- * TileGroupWidget objects and a QTextEdit for user input, along with
+ * This class represents the main application window. It contains the
+ * WheelWidget drawing both tile groups and a QTextEdit for user input, along with
  * the Controller class to handle gamepad inputs.
  */
 class MainWindow : public QMainWindow
@@ -29,9 +37,11 @@ public:
      * Initializes the main window, sets up the UI, and creates the
      * necessary widgets.
      *
+     * @param GamepadId The id of the gamepad driving this window, -1 to use the first allowed one.
+     * @param TextFieldMode The text field to use, the plain one being meant for long documents.
      * @param parent Optional pointer to the parent widget.
      */
-    MainWindow(QWidget *parent = nullptr);
+    MainWindow(const int GamepadId = -1, const TextFieldMode_t TextFieldMode = TEXT_FIELD_RICH, QWidget *parent = nullptr);
 
     /**
      * @brief MainWindow destructor
@@ -39,6 +49,62 @@ public:
      * Cleans up resources used by the MainWindow.
      */
     ~MainWindow();
+
+    /**
+     * @brief Getter for the Controller of the window.
+     * @return The Controller handling the gamepad inputs.
+     */
+    Controller* GetController(void) const;
+
+    /**
+     * @brief Getter for the WheelWidget of the window.
+     * @return The widget drawing both tile groups.
+     */
+    WheelWidget* GetWheel(void) const;
+
+    /**
+     * @brief Getter for the content of the text field.
+     * @return The text typed so far.
+     */
+    QString GetTypedText(void) const;
+
+private slots:
+    /**
+     * @brief Restyles the button guides and the D-pad center for a gamepad brand.
+     * @param Brand The brand of the attached gamepad.
+     */
+    void SetBrand(const brand_t Brand);
+
+private: // Attributes
+    /**
+     * @brief The Controller handling the gamepad inputs.
+     */
+    Controller* _Controller;
+
+    /**
+     * @brief The text field receiving the typed text, nullptr in plain text mode.
+     */
+    QTextEditCustom* _TextField;
+
+    /**
+     * @brief The text field receiving the typed text in plain text mode, nullptr else.
+     */
+    PlainTextFieldWidget* _PlainTextField;
+
+    /**
+     * @brief The widget drawing both tile groups.
+     */
+    WheelWidget* _Wheel;
+
+    /**
+     * @brief The guides of the buttons, restyled when a gamepad of another brand is attached.
+     */
+    QVector<GuideWidget*> _ButtonsGuides;
+
+    /**
+     * @brief The center of the D-pad, hidden for the brands without one.
+     */
+    ImageWidget* _DpadCenter;
 };
 
 #endif // MAINWINDOW_H
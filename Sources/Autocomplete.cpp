@@ -1,15 +1,20 @@
 #include <QChar>
+#include <QElapsedTimer>
+#include <QtConcurrent/QtConcurrent>
 
 #include "Headers/Autocomplete.h"
 #include "Headers/GP4k_Typedefs.h"
+#include "Headers/KeyboardLayout.h"
 
-Autocomplete::Autocomplete()
+Autocomplete::Autocomplete(const QSharedPointer<const Trie> &Dictionary)
+    : _Trie(Dictionary)
 {
-    _Trie = new Trie();
     _Buffer = "";
     _BufferInfo.Index = 0;
     _BufferInfo.Capacity = 0;
     _Suggestions = {};
+    _CharGroup = 0;
+    _PrefetchStats = {0, 0, 0, 0, 0, 0, 0};
 }
 
 actions_t Autocomplete::ChangeCharacter(const QString Character){
@@ -40,13 +45,83 @@ void Autocomplete::ClearBuffer(void){
     _BufferInfo.Index = 0;
     _BufferInfo.Capacity = 0;
     _Suggestions = {};
+    Prefetch(); // The first letter of the next word
 }
 
 void Autocomplete::SeekSuggestions(void){
     const CharGroup_t SkipLastChars = _SkipLastChars;
+    if(_Trie.isNull()){ // Only the latest query matters: it's the one sought by SetDictionary
+        _PrefetchStats.Deferred += (_Buffer != "") ? 1 : 0;
+        _Suggestions = {};
+        return;
+    }
     if(_Buffer != ""){
-        _Suggestions = _Trie->Suggest(_Buffer, SkipLastChars);
+        QElapsedTimer SeekClock;
+        SeekClock.start();
+        const QPair<QString, CharGroup_t> Key(_Buffer, SkipLastChars);
+        if(_Prefetches.contains(Key)){
+            QFuture<QVector<QString>> Prefetched = _Prefetches.take(Key);
+            (Prefetched.isFinished()) ? _PrefetchStats.Hits++ : _PrefetchStats.LateHits++;
+            _Suggestions = Prefetched.result(); // Blocks only for a late hit, still faster than starting over
+        }else{
+            _PrefetchStats.Misses++;
+            _Suggestions = _Trie->Suggest(_Buffer, SkipLastChars);
+        }
+        _PrefetchStats.SeekTime += SeekClock.nsecsElapsed();
+    }
+    Prefetch();
+}
+
+void Autocomplete::Prefetch(void){
+    if(_Trie.isNull()){ // Nothing to query
+        DiscardPrefetches();
+        return;
+    }
+
+    QHash<QPair<QString, CharGroup_t>, QFuture<QVector<QString>>> Previous;
+    Previous.swap(_Prefetches);
+    const KeyboardLayout &Layout = KeyboardLayout::Active();
+    if(Layout.SuggestionTiles(_CharGroup) > 0){ // Else nothing would display the suggestions of the next character
+        for(const QString &Character : Layout.InnerChars(NOT_SHIFTED, _CharGroup)){
+            QString Candidate = _Buffer;
+            Candidate.insert(_BufferInfo.Index, Character.toLower());
+            PrefetchOne(Candidate, _SkipLastChars, Previous);
+        }
+    }
+    if(_Buffer != ""){ // Selecting another group changes the chars to skip of the buffer's suggestions
+        for(int Group = 0; Group < Layout.GroupsCount(); Group++){
+            const CharGroup_t &GroupChars = Layout.InnerChars(NOT_SHIFTED, Group);
+            if(Layout.SuggestionTiles(Group) > 0 && GroupChars != _SkipLastChars){
+                PrefetchOne(_Buffer, GroupChars, Previous);
+            }
+        }
+    }
+    _PrefetchStats.Wasted += Previous.size(); // Not wanted anymore
+}
+
+void Autocomplete::PrefetchOne(const QString &Candidate, const CharGroup_t &SkipLastChars,
+                               QHash<QPair<QString, CharGroup_t>, QFuture<QVector<QString>>> &Previous){
+    const QPair<QString, CharGroup_t> Key(Candidate, SkipLastChars);
+    if(_Prefetches.contains(Key)){
+        return;
     }
+    if(Previous.contains(Key)){ // Already started for the previous input
+        _Prefetches.insert(Key, Previous.take(Key));
+        return;
+    }
+
+    const QSharedPointer<const Trie> Dictionary = _Trie; // Keeps the Trie alive until the last computation ends
+    _Prefetches.insert(Key, QtConcurrent::run([Dictionary, Candidate, SkipLastChars](){
+        return Dictionary->Suggest(Candidate, SkipLastChars);
+    }));
+    _PrefetchStats.Launched++;
+}
+
+void Autocomplete::DiscardPrefetches(void){
+    /* The discarded computations can't be cancelled: they end in the
+     * thread pool, and their results are dropped with the last QFuture. */
+    _PrefetchStats.Wasted += _Prefetches.size();
+    _Prefetches.clear();
 }
 
 actions_t Autocomplete::MoveBufferCursor(const Qt::Key Direction){
@@ -62,21 +137,48 @@ actions_t Autocomplete::MoveBufferCursor(const Qt::Key Direction){
         }
         else{
             _BufferInfo.Index += (Direction == Qt::Key_Left) ? -1 : 1;
+            Prefetch(); // The next character will be inserted elsewhere
             return NOTHING;
         }
     }
     return NOTHING;
 }
 
+void Autocomplete::SetDictionary(const QSharedPointer<const Trie> &Dictionary){
+    _Trie = Dictionary;
+    SeekSuggestions();
+}
+
+bool Autocomplete::HasDictionary(void) const{
+    return !_Trie.isNull();
+}
+
 QVector<QString> Autocomplete::GetSuggestions(void) const{
     return _Suggestions;
 }
 
+QString Autocomplete::GetBuffer(void) const{
+    return _Buffer;
+}
+
 uint8_t Autocomplete::GetBufferIndex(void) const{
     return _BufferInfo.Index;
 }
 
 void Autocomplete::SetSkipLastChars(uint8_t CharGroupIndex){
-    _SkipLastChars = InnerTilesChars[NOT_SHIFTED][CharGroupIndex];
-    SeekSuggestions();
+    _SkipLastChars = KeyboardLayout::Active().InnerChars(NOT_SHIFTED, CharGroupIndex);
+    SeekSuggestions(); // Swaps in the list prefetched with these chars to skip, and prefetches the group's chars
+}
+
+void Autocomplete::SetCharGroup(const uint8_t CharGroupIndex){
+    _CharGroup = CharGroupIndex;
+    if(KeyboardLayout::Active().SuggestionTiles(CharGroupIndex) > 0){
+        SetSkipLastChars(CharGroupIndex);
+    }else{
+        Prefetch();
+    }
+}
+
+PrefetchStats_t Autocomplete::GetPrefetchStats(void) const{
+    return _PrefetchStats;
 }
@@ -1,220 +1,129 @@
 /* Controller.cpp */
 
 #include "Headers/Controller.h"
-#include "Headers/GP4k_TilesMapping.h"
 #include "Headers/GP4k_ButtonsMapping.h"
-#include "Headers/TileGroupWidget.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/Trace.h"
 
 #include <cmath>
 
-#include <QApplication>
-#include <QDebug>
-#include <QKeyEvent>
-#include <QLoggingCategory>
-#include <QtGamepad/QGamepad>
-#include <QTextEdit>
-
-/**
- * @def BORDER_DEAD_ZONE
- * @brief Defines the deadzone around the stick border.
- *
- * @details It's mainly needed to compensate factory default of controllers: my own Nintend switch pro
- * can have a Radius of 0.99 at the border for instance. A higher value is chosen to prevent unwanted types,
- * in cases the user take the stick a bit away when moving it around the border quickly.
- */
-#define BORDER_DEAD_ZONE  0.3F
-
-/**
- * @def HALF_CIRCLE_ANGLE_IN_DEGREE
- * @brief Constant representing the angle for half a circle in degree
- */
-#define HALF_CIRCLE_ANGLE_IN_DEGREE 180U
-
-/**
- * @def RADIAN_TO_DEGREE_FACTOR
- * @brief A constant factor used for radian-degree conversion.
- */
-#define RADIAN_TO_DEGREE_FACTOR HALF_CIRCLE_ANGLE_IN_DEGREE / M_PI
-
-/**
- * @def ANGLE_IN_DEGREE
- * @brief Macrofunction used to convert an angle from radian to degree.
- */
-#define ANGLE_IN_DEGREE(angle) angle*RADIAN_TO_DEGREE_FACTOR + HALF_CIRCLE_ANGLE_IN_DEGREE
-
-Controller::Controller(QWidget *parent)
-    : QWidget{parent}
-    , _SelectedController(nullptr)
+Controller::Controller(QObject *parent)
+    : QObject{parent}
     , _AxisPosition({{0, 0}, {0, 0}})
-    , _Angles({-1, -1})
-    , _Radius({CENTER, CENTER})
+    , _Sticks({StickStateMachine(0), StickStateMachine(DEFAULT_TILE)})
     , _SelectedTiles({0, DEFAULT_TILE})
     , _ShiftKeyState(NOT_SHIFTED)
     , _CapsLockState(false)
-
+    , _Autocompleter(new Autocomplete())
+    , _Recorder(nullptr)
+    , _Emissions(0)
+    , _StickEmissions({0, 0})
+    , _SwipeActive(false)
+    , _SwipeStats({0, 0, 0, 0, 0})
+    , _HandledInputs(0)
+    , _TextEdited(false)
 {
-    QLoggingCategory::setFilterRules(QStringLiteral("qt.gamepad.debug=false"));
-    QList<int> controllers_list = QGamepadManager::instance()->connectedGamepads();
-    if (controllers_list.isEmpty()) {
-        qDebug() << "No controller detected";
-        return;
-    }
-
-    int Controller_SelectedController_ID = -1;
-
-    for (auto current_controller_ID : controllers_list){
-        QString current_controller_name = QGamepadManager::instance()->gamepadName(current_controller_ID);
-        if (!IsItAllowed(current_controller_name)){
-            qDebug() << current_controller_name << "Is not allowed.";
-        }else{
-            Controller_SelectedController_ID = current_controller_ID;
-            _Brand = WhatsTheBrand(current_controller_name);
-            qDebug() << current_controller_name << "(" << _Brand << ") Will be used...";
-            break;
-        }
-    }
-
-    if(Controller_SelectedController_ID == -1){
-        qDebug() << "No supported controller detected";
-        return;
-    }
-
-    _SelectedController = new QGamepad(Controller_SelectedController_ID, this);
-    qDebug() << "Controller connected!";
-
-    _Autocompleter = new Autocomplete();
-
-    connect(_SelectedController, &QGamepad::axisLeftXChanged, this, [this](double Value){
-        UpdateAxis(STICK_LEFT, X_AXIS, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::axisLeftYChanged, this, [this](double Value){
-        UpdateAxis(STICK_LEFT, Y_AXIS, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::axisRightXChanged, this, [this](double Value){
-        UpdateAxis(STICK_RIGHT, X_AXIS, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::axisRightYChanged, this, [this](double Value){
-        UpdateAxis(STICK_RIGHT, Y_AXIS, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonYChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const brand_t Brand = _Brand;
-            const feature_t Feature = (Brand == XBOX) ? Button_Y.Features[ShiftKey] : Button_X.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonXChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const brand_t Brand = _Brand;
-            const feature_t Feature = (Brand == XBOX) ? Button_X.Features[ShiftKey] : Button_Y.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-
-    connect(_SelectedController, &QGamepad::buttonDownChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Dpad_DOWN.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonUpChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Dpad_UP.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonLeftChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Dpad_LEFT.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonRightChanged, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Dpad_RIGHT.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonL2Changed, this, [this](double Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Button_LT.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonL1Changed, this, [this](bool Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Button_LB.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
-    });
-
-    connect(_SelectedController, &QGamepad::buttonR1Changed, this, [this](bool Value){
-            const ShiftState_t ShiftKey = _ShiftKeyState;
-            const feature_t Feature = Button_RB.Features[ShiftKey];
-            ButtonPressed(Feature, Value);
+    _Clock.start();
+    CountEmissions();
+
+    /* The dictionary is built on a worker thread: the window shows up at
+     * once, and the suggestion tiles stay unavailable until it's ready. */
+    QFutureWatcher<QSharedPointer<const Trie>>* DictionaryWatcher = new QFutureWatcher<QSharedPointer<const Trie>>(this);
+    connect(DictionaryWatcher, &QFutureWatcherBase::finished, this, [this, DictionaryWatcher](){
+        SetDictionary(DictionaryWatcher->result());
+        DictionaryWatcher->deleteLater();
     });
+    DictionaryWatcher->setFuture(Trie::SharedAsync());
 }
 
-bool Controller::IsItAllowed(const QString &controllerName) const{
-    return !_ForbiddenControllers.contains(controllerName);
+void Controller::AddInputSource(const InputSource *Source){
+    connect(Source, &InputSource::InputChanged, this, &Controller::HandleInput);
+    connect(Source, &InputSource::InputLost, this, &Controller::ResetInputs);
 }
 
-brand_t Controller::WhatsTheBrand(const QString &controllerName) const{
-    // if(_TestedControllers.contains(controllerName)){return _TestedControllers[controllerName];}
-    // else{return ControllerBrandAutodetect(controllerName);}
-    return (_TestedControllers.contains(controllerName)) ? _TestedControllers[controllerName] : ControllerBrandAutodetect(controllerName);
+void Controller::HandleInput(const GamepadInput_t Input, const double Value){
+    HandleTimedInput(Input, Value, static_cast<quint64>(_Clock.nsecsElapsed() / 1000));
 }
 
-brand_t Controller::ControllerBrandAutodetect(const QString &controllerName) const{
-    const QMap<QString, brand_t> BrandKeywords{
-        {"x-box", XBOX}, {"xbox", XBOX}, {"microsoft", XBOX},
-        {"playstation", PLAYSTATION}, {"dualshock", PLAYSTATION}, {"dual shock", PLAYSTATION}, {"dualsense", PLAYSTATION},
-        {"dual sense", PLAYSTATION}, {"ps", PLAYSTATION}, {"sony", PLAYSTATION},
-        {"switch", NINTENDO}, {"nintendo", NINTENDO}
-    };
-    for (const QString& Keyword : BrandKeywords.keys()) {
-        if(controllerName.contains(Keyword, Qt::CaseInsensitive)){return BrandKeywords[Keyword];}
+void Controller::HandleTimedInput(const GamepadInput_t Input, const double Value, const quint64 Timestamp){
+    GP4K_TRACE_SPAN(TRACE_EVENTS, "Controller::HandleInput");
+    if(_Recorder != nullptr){
+        _Recorder->Record(Input, Value, Timestamp);
+    }
+    _HandledInputs++;
+
+    const ShiftState_t ShiftKey = _ShiftKeyState;
+    switch (Input) {
+    case INPUT_AXIS_LEFT_X:
+        UpdateAxis(STICK_LEFT, X_AXIS, Value, Timestamp);
+        break;
+    case INPUT_AXIS_LEFT_Y:
+        UpdateAxis(STICK_LEFT, Y_AXIS, Value, Timestamp);
+        break;
+    case INPUT_AXIS_RIGHT_X:
+        UpdateAxis(STICK_RIGHT, X_AXIS, Value, Timestamp);
+        break;
+    case INPUT_AXIS_RIGHT_Y:
+        UpdateAxis(STICK_RIGHT, Y_AXIS, Value, Timestamp);
+        break;
+    case INPUT_BUTTON_X:
+    case INPUT_BUTTON_Y:
+    case INPUT_BUTTON_LB:
+    case INPUT_BUTTON_RB:
+    case INPUT_BUTTON_LT:
+    case INPUT_DPAD_UP:
+    case INPUT_DPAD_DOWN:
+    case INPUT_DPAD_LEFT:
+    case INPUT_DPAD_RIGHT:
+        ButtonPressed(KeyboardLayout::Active().ButtonFeature(Input, ShiftKey), Value);
+        break;
+    case INPUT_BUTTON_RT:
+        SwipeButton(Value);
+        break;
+    default:
+        // Input is enum type GamepadInput_t: No other possible option
+        break;
+    }
+    PublishWheelDelta(); // Once, whatever the number of tiles the event changed
+    if(_TextEdited){
+        _TextEdited = false;
+        emit TextEditsEnded();
     }
-    return XBOX; // Default return to ensure the demo can run.
 }
 
-void Controller::UpdateAxis(const stick_t Stick, const axis_t Axis, const double AxisValue){
-    _AxisPosition[Stick][Axis] = AxisValue;
-    UpdateRadius(Stick);
+void Controller::SetRecorder(InputRecorder *Recorder){
+    _Recorder = Recorder;
 }
 
-void Controller::UpdateRadius(const stick_t Stick){
-    const StickPosition_t Radius = NormalizeRadius(Stick);
-    if(Radius == BORDER){
-        UpdateAngle(Stick);
-    }else{
-        StickReleased(Radius, Stick);
+void Controller::ResetInputs(void){
+    for(const stick_t Stick : {STICK_LEFT, STICK_RIGHT}){
+        _AxisPosition[Stick] = {0, 0};
+        _Sticks[Stick].Center();
     }
-    _Radius[Stick] = Radius;
+    _SwipeActive = false;
+    _SwipePath.clear();
 }
 
-StickPosition_t Controller::NormalizeRadius(const stick_t Stick) const{
+void Controller::UpdateAxis(const stick_t Stick, const axis_t Axis, const double AxisValue, const quint64 Timestamp){
+    _AxisPosition[Stick][Axis] = AxisValue;
     const double PositionX = _AxisPosition[Stick][X_AXIS];
     const double PositionY = _AxisPosition[Stick][Y_AXIS];
-    double Radius = sqrt(pow(PositionX, 2) + pow(PositionY, 2));
-    /*
-     * The stick radius varies across controllers and angles due to drift or manufacturing imperfections.
-     * This condition normalizes the radius to distinguish between "on the border" and "at the center."
-     */
-    return (Radius >= static_cast<double>(BORDER) - BORDER_DEAD_ZONE) ? BORDER : CENTER;
+    const uint8_t Events = _Sticks[Stick].Update(PositionX, PositionY, static_cast<qint64>(Timestamp / 1000));
+
+    const quint64 EmissionsBefore = _Emissions;
+    if(Events & STICK_TILE_CHANGED){
+        UpdateSelectedTile(Stick);
+    }
+    if(Events & STICK_RELEASED){
+        StickReleased(Stick);
+    }
+    // The wheel changes of the transition are sent at the end of HandleInput
+    const quint64 PendingWheelUpdate = _WheelDelta.IsEmpty() ? 0 : 1;
+    _StickEmissions[Stick] += _Emissions - EmissionsBefore + PendingWheelUpdate;
 }
 
-void Controller::StickReleased(const StickPosition_t NewRadius, const stick_t Stick){
-    const double CurrentRadius = _Radius[Stick];
-    /*
-         * The stick emits redundant X and Y signals during release, causing
-         * repetitive radius calculations. This condition prevents unnecessary
-         * operations and only applies to the right stick.
-         */
-    if(NewRadius != CurrentRadius && Stick == STICK_RIGHT){
+void Controller::StickReleased(const stick_t Stick){
+    if(Stick == STICK_RIGHT && !_SwipeActive){ // A swipe types its word when the trigger is released
         const uint8_t OuterTileIndex = _SelectedTiles[STICK_LEFT];
         const uint8_t InnerTileIndex = _SelectedTiles[STICK_RIGHT];
         /*
@@ -222,48 +131,39 @@ void Controller::StickReleased(const StickPosition_t NewRadius, const stick_t St
              * the suggestions tiles: The 0, 2 or 3 last tiles,
              * depending on outer selected tile.
              */
-        const uint8_t LastCharacterTileIndex = MAX_TILE_INDEX - GroupsSuggestionsMap[OuterTileIndex];
+        const uint8_t LastCharacterTileIndex = KeyboardLayout::Active().LastCharTile(OuterTileIndex);
         (InnerTileIndex <= LastCharacterTileIndex) ? CharTileSelected(InnerTileIndex, OuterTileIndex) : TypeSuggestion(InnerTileIndex);
     }
 }
 
 void Controller::CharTileSelected(const uint8_t CharTileIndex, const uint8_t CharGroup){
     const ShiftState_t ShiftKey = _ShiftKeyState;
-    const QString Letter = InnerTilesChars[ShiftKey][CharGroup][CharTileIndex];
+    const QString Letter = KeyboardLayout::Active().InnerChars(ShiftKey, CharGroup)[CharTileIndex];
+    emit CharTyped(Letter);
     TypeChar(Letter);
     AutocompleterUpdate(Qt::Key_A, Letter); // Key_A is to trigger default case of AutocompleterUpdate
 }
 
-void Controller::UpdateAngle(const stick_t Stick){
-    const double PositionX = _AxisPosition[Stick][X_AXIS];
-    const double PositionY = _AxisPosition[Stick][Y_AXIS];
-    const double AngleRadian = atan2(PositionY, PositionX);
-    const double AngleDegree = ANGLE_IN_DEGREE(AngleRadian);
-    _Angles[Stick] = AngleDegree;
-    UpdateSelectedTile(Stick);
-}
-
 void Controller::UpdateSelectedTile(const stick_t Stick){
-
-    const double Angle = _Angles[Stick];
-    const double MovedAngle = std::fmod(Angle+22.5,360.0);
-    const uint8_t NewTile = static_cast<uint8_t>(MovedAngle/45);
-    const uint8_t CurrentTile = _SelectedTiles[Stick];
-
-    if(CurrentTile != NewTile){
-        _SelectedTiles[Stick] = NewTile;
-        _Angles[Stick] = -1;
-        if(Stick == STICK_LEFT){
-            emit ToggleOuterSelectedTile(NewTile);
-            emit ResetCenterBackgrounds();
-            emit UpdateInnerTiles(_ShiftKeyState, NewTile);
-            if(GroupsSuggestionsMap[NewTile] > 0){
-                _Autocompleter->SetSkipLastChars(NewTile);
-                QueryingSuggestions();
-            }
-            _SelectedTiles[STICK_RIGHT] = DEFAULT_TILE;
-        }else{
-            emit ToggleInnerSelectedTile(NewTile);
+    const uint8_t NewTile = _Sticks[Stick].GetTile();
+    _SelectedTiles[Stick] = NewTile;
+    if(Stick == STICK_LEFT){
+        _WheelDelta.SelectOuterTile(NewTile);
+        _WheelDelta.ResetInnerTiles();
+        _WheelDelta.SetInnerTexts(_ShiftKeyState, NewTile);
+        _Autocompleter->SetCharGroup(NewTile);
+        if(KeyboardLayout::Active().SuggestionTiles(NewTile) > 0){
+            QueryingSuggestions();
+        }
+        _SelectedTiles[STICK_RIGHT] = DEFAULT_TILE;
+        _Sticks[STICK_RIGHT].ResetTile();
+    }else{
+        _WheelDelta.SelectInnerTile(NewTile);
+        const uint8_t CharGroup = _SelectedTiles[STICK_LEFT];
+        const SwipeKey_t Key = {CharGroup, NewTile};
+        const bool IsCharTile = (NewTile <= KeyboardLayout::Active().LastCharTile(CharGroup));
+        if(_SwipeActive && IsCharTile && (_SwipePath.isEmpty() || !(_SwipePath.last() == Key))){
+            _SwipePath.append(Key);
         }
     }
 }
@@ -277,6 +177,7 @@ void Controller::ButtonPressed(feature_t Feature, const double ButtonValue){
 
         switch (FeatureType) {
         case TEXT_CONTROL: // Moves, space and backspace
+            _TextEdited = true;
             emit SendOrderToTextField(Key);
             AutocompleterUpdate(Key, Text);
             break;
@@ -287,10 +188,12 @@ void Controller::ButtonPressed(feature_t Feature, const double ButtonValue){
              * in the string, which is the char that should actually
              * be typed in the text field.
              */
+            emit CharTyped(Text[1]);
             TypeChar(Text[1]);
             ButtonPressed(SPACE);
             break;
         case WORD_CONNECTOR: // Hyphen and apostrophe
+            emit CharTyped(Text[1]);
             TypeChar(Text[1]);
             AutocompleterUpdate(Key, Text[1]);
             break;
@@ -304,7 +207,7 @@ void Controller::ButtonPressed(feature_t Feature, const double ButtonValue){
 }
 
 void Controller::AutocompleterUpdate(const Qt::Key Key, const QString Text){
-    Autocomplete* Autocompleter = _Autocompleter;
+    Autocomplete* Autocompleter = _Autocompleter.data();
     actions_t ResultOnBuffer = NOTHING;
     switch (Key) {
     case Qt::Key_Space:
@@ -342,41 +245,87 @@ void Controller::ShiftButton(){
         _CapsLockState = CapsLock;
         _ShiftKeyState = ShiftKey;
         uint8_t CurrentCharGroup = _SelectedTiles[STICK_LEFT];
-        emit ToggleTextsOnShift(ShiftKey, CurrentCharGroup);
+        _WheelDelta.SetOuterTexts(ShiftKey);
+        _WheelDelta.SetInnerTexts(ShiftKey, CurrentCharGroup);
 }
 
-brand_t Controller::GetBrand(void) const{
-    return _Brand;
+void Controller::SwipeButton(const double ButtonValue){
+    if(!_SwipeActive && ButtonValue >= SWIPE_TRIGGER_THRESHOLD){
+        _SwipeActive = true;
+        _SwipePath.clear();
+        /* The right stick keeps its tile after a release: unselecting it
+         * makes the first tile of the swipe a change, even if it's the
+         * tile of the last typed character. */
+        _SelectedTiles[STICK_RIGHT] = DEFAULT_TILE;
+        _Sticks[STICK_RIGHT].ResetTile();
+        _WheelDelta.SelectInnerTile(DEFAULT_TILE);
+    }else if(_SwipeActive && ButtonValue == 0.0){
+        _SwipeActive = false;
+        SwipeEnded();
+    }
+}
+
+void Controller::SwipeEnded(void){
+    const QString Prefix = _Autocompleter->GetBuffer().left(_Autocompleter->GetBufferIndex());
+    QElapsedTimer DecodeClock;
+    DecodeClock.start();
+    const QVector<QString> Candidates = _Decoder.Decode(_SwipePath, Prefix);
+    const qint64 DecodeTime = DecodeClock.nsecsElapsed();
+
+    _SwipeStats.Swipes++;
+    _SwipeStats.Keys += _SwipePath.size();
+    _SwipeStats.DecodeTime += DecodeTime;
+    _SwipeStats.MaxDecodeTime = qMax(_SwipeStats.MaxDecodeTime, DecodeTime);
+
+    _SelectedTiles[STICK_RIGHT] = DEFAULT_TILE;
+    _Sticks[STICK_RIGHT].ResetTile();
+    _WheelDelta.SelectInnerTile(DEFAULT_TILE);
+
+    if(Candidates.isEmpty()){
+        GP4K_TRACE_INSTANT(TRACE_DETAIL, "Controller::SwipeEnded no match");
+        return;
+    }
+    _SwipeStats.Words++;
+
+    QString Word = Candidates.first();
+    Word.remove(0, Prefix.length()); // Already typed
+    if(_CapsLockState == true){ Word = Word.toUpper(); }
+    else if(_ShiftKeyState == SHIFTED){ Word[0] = Word[0].toUpper(); }
+    TypeChar(Word);
+    ButtonPressed(SPACE);
 }
 
 void Controller::TypeChar(const QString Letter){
+    _TextEdited = true;
     emit TypeToTextField(Letter);
     ToggleShift();
 }
 
 void Controller::ToggleShift(){
     const bool CapsLock = _CapsLockState;
-    if(!CapsLock){
+    if(!CapsLock){ // Already unshifted most of the time: the view model drops the texts then
         _ShiftKeyState = NOT_SHIFTED;
         uint8_t CurrentCharGroup = _SelectedTiles[STICK_LEFT];
-        emit ToggleTextsOnShift(_ShiftKeyState, CurrentCharGroup);
+        _WheelDelta.SetOuterTexts(_ShiftKeyState);
+        _WheelDelta.SetInnerTexts(_ShiftKeyState, CurrentCharGroup);
     }
 }
 
 void Controller::QueryingSuggestions(void){
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "Controller::QueryingSuggestions");
     _Suggestions = _Autocompleter->GetSuggestions();
     const uint8_t NumberOfSuggestions = _Suggestions.length();
     const uint8_t CharGroup = _SelectedTiles[STICK_LEFT];
-    const uint8_t NumberSuggestionTiles = GroupsSuggestionsMap[CharGroup];
+    const uint8_t NumberSuggestionTiles = KeyboardLayout::Active().SuggestionTiles(CharGroup);
     uint8_t SuggestionTileIndex;
     QString Suggestion;
     for(uint8_t suggestionIndex = 0; suggestionIndex < NumberSuggestionTiles; suggestionIndex++){
         SuggestionTileIndex = MAX_TILE_INDEX - suggestionIndex;
         if(suggestionIndex < NumberOfSuggestions){
             Suggestion = _Suggestions[suggestionIndex];
-            emit UpdateSuggestionTile(SuggestionTileIndex, Suggestion);
+            _WheelDelta.SetSuggestion(SuggestionTileIndex, Suggestion);
         }else{
-            emit UpdateSuggestionTile(SuggestionTileIndex, "");
+            _WheelDelta.SetSuggestion(SuggestionTileIndex, "");
         }
     }
 }
@@ -388,12 +337,104 @@ void Controller::TypeSuggestion(const uint8_t TileIndex){
         const uint8_t BufferIndex = _Autocompleter->GetBufferIndex();
         Suggestion.remove(0, BufferIndex);
         if(_CapsLockState == true){ Suggestion = Suggestion.toUpper();}
+        _TextEdited = true;
         emit TypeToTextField(Suggestion);
         ButtonPressed(SPACE);
     }
 }
 
+StickMetrics_t Controller::GetStickMetrics(const stick_t Stick) const{
+    return _Sticks[Stick].GetMetrics();
+}
+
+quint64 Controller::GetSuppressedEmissions(void) const{
+    quint64 SuppressedEmissions = 0;
+    for(const stick_t Stick : {STICK_LEFT, STICK_RIGHT}){
+        const StickMetrics_t Metrics = _Sticks[Stick].GetMetrics();
+        const quint64 Transitions = Metrics.TileChanges + Metrics.Releases;
+        const quint64 SingleThresholdTransitions = Metrics.SingleThresholdTileChanges + Metrics.SingleThresholdReleases;
+        if(Transitions > 0 && SingleThresholdTransitions > Transitions){
+            // Each suppressed transition is worth the average fan-out measured on the transitions that did happen
+            SuppressedEmissions += (SingleThresholdTransitions - Transitions) * _StickEmissions[Stick] / Transitions;
+        }
+    }
+    return SuppressedEmissions;
+}
+
+SwipeStats_t Controller::GetSwipeStats(void) const{
+    return _SwipeStats;
+}
+
+quint64 Controller::GetHandledInputs(void) const{
+    return _HandledInputs;
+}
+
+quint64 Controller::GetEmissions(void) const{
+    return _Emissions;
+}
+
+ViewModelStats_t Controller::GetViewModelStats(void) const{
+    return _ViewModel.GetStats();
+}
+
+PrefetchStats_t Controller::GetPrefetchStats(void) const{
+    return _Autocompleter->GetPrefetchStats();
+}
+
+void Controller::CountEmissions(void){
+    auto Count = [this](){ _Emissions++; };
+    connect(this, &Controller::UpdateWheel, this, Count);
+    connect(this, &Controller::TypeToTextField, this, Count);
+    connect(this, &Controller::CharTyped, this, Count);
+    connect(this, &Controller::SendOrderToTextField, this, Count);
+    connect(this, &Controller::TextEditsEnded, this, Count);
+    connect(this, &Controller::ToggleTextsOnShift, this, Count);
+    connect(this, &Controller::DictionaryReady, this, Count);
+}
+
+void Controller::SetDictionary(const QSharedPointer<const Trie> &Dictionary){
+    if(_Autocompleter->HasDictionary()){
+        return;
+    }
+    _Autocompleter->SetDictionary(Dictionary); // Seeks the suggestions of the buffer typed while loading
+    _Decoder.SetDictionary(Dictionary);
+    QueryingSuggestions();
+    PublishWheelDelta();
+    emit DictionaryReady();
+}
+
 void Controller::InitializeTilesContent(void){
-    emit ToggleOuterSelectedTile(0);
+    _WheelDelta.SelectOuterTile(0);
+    _Autocompleter->SetCharGroup(_SelectedTiles[STICK_LEFT]); // Its chars are skipped from the first suggestions
+    QueryingSuggestions();
+    PublishWheelDelta();
+}
+
+void Controller::ReloadLayout(void){
+    const uint8_t CharGroup = _SelectedTiles[STICK_LEFT];
+    _Decoder.ReloadKeys();
+    _SwipePath.clear(); // Its tiles may hold other chars now
+    _Autocompleter->SetCharGroup(CharGroup);
+    _ViewModel.InvalidateTexts();
+    _WheelDelta.SetOuterTexts(_ShiftKeyState);
+    _WheelDelta.ResetInnerTiles(); // A char tile may have been a suggestion tile
+    _WheelDelta.SetInnerTexts(_ShiftKeyState, CharGroup);
+    _SelectedTiles[STICK_RIGHT] = DEFAULT_TILE;
+    _Sticks[STICK_RIGHT].ResetTile();
     QueryingSuggestions();
+    PublishWheelDelta(); // Also switches the guides, as the outer texts are stale
+}
+
+void Controller::PublishWheelDelta(void){
+    if(_WheelDelta.IsEmpty()){
+        return;
+    }
+    const WheelDelta Changes = _ViewModel.Diff(_WheelDelta);
+    _WheelDelta.Clear();
+    if(Changes.Fields & DELTA_OUTER_TEXTS){ // The guides follow the shift state of the outer tiles
+        emit ToggleTextsOnShift(Changes.OuterShift, _SelectedTiles[STICK_LEFT]);
+    }
+    if(!Changes.IsEmpty()){
+        emit UpdateWheel(Changes);
+    }
 }
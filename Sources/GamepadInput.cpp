@@ -0,0 +1,181 @@
+/* GamepadInput.cpp */
+
+#include "Headers/GamepadInput.h"
+
+#include <QDebug>
+#include <QLoggingCategory>
+#include <QSignalBlocker>
+
+GamepadInput::GamepadInput(const int GamepadId, QObject *parent)
+    : InputSource{parent}
+    , _SelectedController(nullptr)
+    , _GamepadId(-1)
+    , _Brand(XBOX)
+{
+    /* The QGamepad is created once and only switches of device: the
+     * connections below and the session survive the disconnections of
+     * the gamepad. */
+    _SelectedController = new QGamepad(-1, this);
+
+    if(GamepadId != -1){
+        AttachGamepad(GamepadId);
+    }else{
+        AttachFirstAvailableGamepad();
+    }
+
+    connect(QGamepadManager::instance(), &QGamepadManager::gamepadConnected, this, [this](){
+        if(_GamepadId == -1){
+            AttachFirstAvailableGamepad();
+        }
+    });
+
+    connect(QGamepadManager::instance(), &QGamepadManager::gamepadDisconnected, this, [this](int DisconnectedId){
+        if(DisconnectedId == _GamepadId){
+            qDebug() << "Controller disconnected, the session is kept";
+            DetachGamepad();
+            AttachFirstAvailableGamepad();
+        }
+    });
+
+    connect(_SelectedController, &QGamepad::axisLeftXChanged, this, [this](double Value){
+        emit InputChanged(INPUT_AXIS_LEFT_X, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::axisLeftYChanged, this, [this](double Value){
+        emit InputChanged(INPUT_AXIS_LEFT_Y, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::axisRightXChanged, this, [this](double Value){
+        emit InputChanged(INPUT_AXIS_RIGHT_X, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::axisRightYChanged, this, [this](double Value){
+        emit InputChanged(INPUT_AXIS_RIGHT_Y, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonYChanged, this, [this](double Value){
+            emit InputChanged((_Brand == XBOX) ? INPUT_BUTTON_Y : INPUT_BUTTON_X, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonXChanged, this, [this](double Value){
+            emit InputChanged((_Brand == XBOX) ? INPUT_BUTTON_X : INPUT_BUTTON_Y, Value);
+    });
+
+
+    connect(_SelectedController, &QGamepad::buttonDownChanged, this, [this](double Value){
+            emit InputChanged(INPUT_DPAD_DOWN, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonUpChanged, this, [this](double Value){
+            emit InputChanged(INPUT_DPAD_UP, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonLeftChanged, this, [this](double Value){
+            emit InputChanged(INPUT_DPAD_LEFT, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonRightChanged, this, [this](double Value){
+            emit InputChanged(INPUT_DPAD_RIGHT, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonL2Changed, this, [this](double Value){
+            emit InputChanged(INPUT_BUTTON_LT, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonR2Changed, this, [this](double Value){
+            emit InputChanged(INPUT_BUTTON_RT, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonL1Changed, this, [this](bool Value){
+            emit InputChanged(INPUT_BUTTON_LB, Value);
+    });
+
+    connect(_SelectedController, &QGamepad::buttonR1Changed, this, [this](bool Value){
+            emit InputChanged(INPUT_BUTTON_RB, Value);
+    });
+}
+
+GamepadInput::~GamepadInput()
+{
+    _ClaimedGamepads.remove(_GamepadId);
+}
+
+void GamepadInput::AttachGamepad(const int GamepadId){
+    const QString SelectedControllerName = QGamepadManager::instance()->gamepadName(GamepadId);
+    const brand_t PreviousBrand = _Brand;
+    _Brand = WhatsTheBrand(SelectedControllerName);
+    qDebug() << SelectedControllerName << "(" << _Brand << ") Will be used...";
+
+    _GamepadId = GamepadId;
+    _ClaimedGamepads.insert(GamepadId);
+    _SelectedController->setDeviceId(GamepadId);
+    if(_Brand != PreviousBrand){
+        emit BrandChanged(_Brand);
+    }
+}
+
+bool GamepadInput::AttachFirstAvailableGamepad(void){
+    for(const int AllowedId : AllowedGamepads()){
+        if(!_ClaimedGamepads.contains(AllowedId)){ // Not driving another session
+            AttachGamepad(AllowedId);
+            return true;
+        }
+    }
+    qDebug() << "No supported controller detected, waiting for one...";
+    return false;
+}
+
+void GamepadInput::DetachGamepad(void){
+    _ClaimedGamepads.remove(_GamepadId);
+    _GamepadId = -1;
+    {
+        const QSignalBlocker Blocker(_SelectedController); // No input from a gamepad that's gone
+        _SelectedController->setDeviceId(-1);
+    }
+    emit InputLost();
+}
+
+QList<int> GamepadInput::AllowedGamepads(void){
+    QLoggingCategory::setFilterRules(QStringLiteral("qt.gamepad.debug=false"));
+    QList<int> controllers_list = QGamepadManager::instance()->connectedGamepads();
+    if (controllers_list.isEmpty()) {
+        qDebug() << "No controller detected";
+        return controllers_list;
+    }
+
+    QList<int> AllowedList;
+    for (auto current_controller_ID : controllers_list){
+        QString current_controller_name = QGamepadManager::instance()->gamepadName(current_controller_ID);
+        if (!IsItAllowed(current_controller_name)){
+            qDebug() << current_controller_name << "Is not allowed.";
+        }else{
+            AllowedList.append(current_controller_ID);
+        }
+    }
+    return AllowedList;
+}
+
+bool GamepadInput::IsItAllowed(const QString &controllerName){
+    return !_ForbiddenControllers.contains(controllerName);
+}
+
+brand_t GamepadInput::WhatsTheBrand(const QString &controllerName){
+    return (_TestedControllers.contains(controllerName)) ? _TestedControllers[controllerName] : ControllerBrandAutodetect(controllerName);
+}
+
+brand_t GamepadInput::ControllerBrandAutodetect(const QString &controllerName){
+    const QMap<QString, brand_t> BrandKeywords{
+        {"x-box", XBOX}, {"xbox", XBOX}, {"microsoft", XBOX},
+        {"playstation", PLAYSTATION}, {"dualshock", PLAYSTATION}, {"dual shock", PLAYSTATION}, {"dualsense", PLAYSTATION},
+        {"dual sense", PLAYSTATION}, {"ps", PLAYSTATION}, {"sony", PLAYSTATION},
+        {"switch", NINTENDO}, {"nintendo", NINTENDO}
+    };
+    for (const QString& Keyword : BrandKeywords.keys()) {
+        if(controllerName.contains(Keyword, Qt::CaseInsensitive)){return BrandKeywords[Keyword];}
+    }
+    return XBOX; // Default return to ensure the demo can run.
+}
+
+brand_t GamepadInput::GetBrand(void) const{
+    return _Brand;
+}
@@ -0,0 +1,37 @@
+#include <QGuiApplication>
+#include <QScreen>
+
+#include "Headers/GuiScale.h"
+#include "Headers/GP4k_GuiMapping.h"
+
+void GuiScale::Initialize(const double ConfiguredScale){
+    double Scale = ConfiguredScale;
+    const QScreen *Screen = QGuiApplication::primaryScreen();
+    if(Scale <= 0.0 && Screen != nullptr){
+        Scale = Screen->logicalDotsPerInch() / REFERENCE_DPI;
+        // A fixed size window larger than the screen can't be used: the scale is reduced to fit it
+        const QSize Available = Screen->availableGeometry().size();
+        Scale = qMin(Scale, qMin(static_cast<double>(Available.width()) / (WINDOW_SIZE_X),
+                                 static_cast<double>(Available.height()) / (WINDOW_SIZE_Y)));
+    }
+    if(Scale <= 0.0){ // No screen, as with the offscreen platform
+        Scale = 1.0;
+    }
+    _CellSize = qMax(qRound(CELL_SIZE * Scale), MIN_CELL_SIZE);
+}
+
+int GuiScale::CellSize(void){
+    return _CellSize;
+}
+
+QRect GuiScale::ToPixels(const placement_t &Placement){
+    return QRect(Placement.X * _CellSize, Placement.Y * _CellSize, Placement.SizeX * _CellSize, Placement.SizeY * _CellSize);
+}
+
+int GuiScale::FontSize(void){
+    return (GLOBAL_FONT_SIZE) * _CellSize / CELL_SIZE;
+}
+
+QSize GuiScale::WindowSize(void){
+    return QSize((WINDOW_SIZE_X) / CELL_SIZE * _CellSize, (WINDOW_SIZE_Y) / CELL_SIZE * _CellSize);
+}
@@ -2,7 +2,10 @@
 #include <QHBoxLayout>
 #include "Headers/GP4k_ButtonsMapping.h"
 #include "Headers/GP4k_GuiMapping.h"
-#include "qdebug.h"
+#include "Headers/GuiScale.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/RasterAtlas.h"
+#include "Headers/Trace.h"
 
 GuideWidget::GuideWidget(const PhysicalButton_t* Button,
                          const brand_t Brand,
@@ -16,7 +19,7 @@ GuideWidget::GuideWidget(const PhysicalButton_t* Button,
 
     QFont font;
     font.setFamily(GLOBAL_FONT);
-    font.setPointSize(GLOBAL_FONT_SIZE);
+    font.setPointSize(GuiScale::FontSize());
     font.setWeight(QFont::ExtraBold);
     _Label = new QLabel(this);
     _Label->setFont(font);
@@ -63,14 +66,11 @@ GuideWidget::GuideWidget(const PhysicalButton_t* Button,
 }
 
 void GuideWidget::SetGeometryOnGrid(const placement_t WidgetPlacement) {
-    int X = WidgetPlacement.X*CELL_SIZE;
-    int Y = WidgetPlacement.Y*CELL_SIZE;
-    int SizeX = WidgetPlacement.SizeX*CELL_SIZE;
-    int SizeY = WidgetPlacement.SizeY*CELL_SIZE;
-    setGeometry(X, Y, SizeX, SizeY);
+    setGeometry(GuiScale::ToPixels(WidgetPlacement));
 }
 
 void GuideWidget::SetIcon(const brand_t Brand){
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "GuideWidget::SetIcon");
     QString IconPath = ":/Resources/Icons/";
 
     switch (Brand) {
@@ -96,17 +96,22 @@ void GuideWidget::SetIcon(const brand_t Brand){
     IconPath.append(".svg");
 
 
-    QPixmap pixmap(IconPath);
-    qDebug() << IconPath;
+    // Read at its displayed size once for all the windows, instead of rescaled here
+    const int IconSize = 2*GuiScale::CellSize();
+    const QPixmap &pixmap = RasterAtlas::Get(IconPath, QSize(IconSize, IconSize), Qt::KeepAspectRatio);
     Q_ASSERT(!pixmap.isNull());
 
-    int width = 2*CELL_SIZE;
-    int height = 2*CELL_SIZE;
-    _Icon->setPixmap(pixmap.scaled(width, height, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    _Icon->setPixmap(pixmap);
 }
 
 void GuideWidget::SetGuideText(const ShiftState_t ShiftKey){
-    _Label->setText(_PhysicalButton->Features[ShiftKey].Text);
+    // The colors and the icon are the ones of the button; the features are the ones of the active layout
+    _Label->setText(KeyboardLayout::Active().ButtonFeature(_PhysicalButton->IconName, ShiftKey).Text);
+}
+
+void GuideWidget::SetBrand(const brand_t Brand){
+    SetIcon(Brand);
+    _Label->setStyleSheet(_PhysicalButton->Colors[Brand]);
 }
 
 QString GuideWidget::GetIconName(void) const{
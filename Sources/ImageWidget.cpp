@@ -1,19 +1,25 @@
 #include "Headers/ImageWidget.h"
 #include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
+#include "Headers/RasterAtlas.h"
 
 ImageWidget::ImageWidget(const QString& ImagePath, QWidget *parent)
     : QLabel(parent)
+    , _ImagePath(ImagePath)
 {
-    QPixmap SticksIcon(ImagePath);
-    setPixmap(SticksIcon);
-    setScaledContents(true); // Ensures the image scales to the label's size
+
 }
 
 void ImageWidget::SetGeometryOnGrid(const placement_t& WidgetPlacement)
 {
-    int X = WidgetPlacement.X * CELL_SIZE;
-    int Y = WidgetPlacement.Y * CELL_SIZE;
-    int SizeX = WidgetPlacement.SizeX * CELL_SIZE;
-    int SizeY = WidgetPlacement.SizeY * CELL_SIZE;
-    setGeometry(X, Y, SizeX, SizeY);
+    const QRect Geometry = GuiScale::ToPixels(WidgetPlacement);
+    setGeometry(Geometry);
+    // Read at the size of the label, as the scaled contents did at each resize
+    setPixmap(RasterAtlas::Get(_ImagePath, Geometry.size(), Qt::IgnoreAspectRatio));
+}
+
+void ImageWidget::SetImage(const QString& ImagePath)
+{
+    _ImagePath = ImagePath;
+    setPixmap(RasterAtlas::Get(_ImagePath, size(), Qt::IgnoreAspectRatio));
 }
@@ -0,0 +1,80 @@
+#include <QDataStream>
+#include <QDebug>
+#include <QFile>
+
+#include "Headers/InputRecorder.h"
+
+void InputRecorder::Record(const GamepadInput_t Input, const double Value, const quint64 Timestamp){
+    _Events.append({Timestamp, Input, static_cast<float>(Value)});
+}
+
+int InputRecorder::GetEventsCount(void) const{
+    return _Events.length();
+}
+
+bool InputRecorder::Save(const QString &FilePath, const QString &ResultingText) const{
+    QFile LogFile(FilePath);
+    if(!LogFile.open(QIODevice::WriteOnly)){
+        qWarning() << "Cannot open" << FilePath << "to save the input log.";
+        return false;
+    }
+
+    QDataStream LogStream(&LogFile);
+    LogStream.setVersion(QDataStream::Qt_5_15);
+    LogStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    LogStream << quint32(INPUT_LOG_MAGIC) << quint16(INPUT_LOG_VERSION) << quint32(_Events.length());
+    for(const InputEvent_t &Event : _Events){
+        LogStream << Event.Timestamp << quint8(Event.Input) << Event.Value;
+    }
+    LogStream << ResultingText;
+
+    return (LogStream.status() == QDataStream::Ok);
+}
+
+bool InputRecorder::Load(const QString &FilePath, InputLog_t &Log){
+    QFile LogFile(FilePath);
+    if(!LogFile.open(QIODevice::ReadOnly)){
+        qWarning() << "Cannot open" << FilePath << "to load the input log.";
+        return false;
+    }
+
+    QDataStream LogStream(&LogFile);
+    LogStream.setVersion(QDataStream::Qt_5_15);
+    LogStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 Magic;
+    quint16 Version;
+    quint32 NumberOfEvents;
+    LogStream >> Magic >> Version >> NumberOfEvents;
+    if(Magic != INPUT_LOG_MAGIC || Version != INPUT_LOG_VERSION){
+        qWarning() << FilePath << "is not a GP4k input log, or was recorded with another version.";
+        return false;
+    }
+    // The count is read from the file: no more events than the file can hold are allocated
+    if(NumberOfEvents > (LogFile.size() - LogFile.pos()) / INPUT_LOG_EVENT_SIZE){
+        qWarning() << FilePath << "is truncated: it can't hold its" << NumberOfEvents << "events.";
+        return false;
+    }
+
+    Log.Events.clear();
+    Log.Events.reserve(NumberOfEvents);
+    quint64 Timestamp;
+    quint8 Input;
+    float Value;
+    for(quint32 EventIndex = 0; EventIndex < NumberOfEvents; EventIndex++){
+        LogStream >> Timestamp >> Input >> Value;
+        if(LogStream.status() != QDataStream::Ok){
+            qWarning() << FilePath << "can't be read at event" << EventIndex;
+            return false;
+        }
+        if(Input >= NUMBER_OF_INPUTS){ // Corrupted log: replaying it would be meaningless
+            qWarning() << FilePath << "holds an unknown input at event" << EventIndex;
+            return false;
+        }
+        Log.Events.append({Timestamp, static_cast<GamepadInput_t>(Input), Value});
+    }
+    LogStream >> Log.ExpectedText;
+
+    return (LogStream.status() == QDataStream::Ok);
+}
@@ -0,0 +1,80 @@
+#include <QTimer>
+
+#include "Headers/InputReplayer.h"
+
+InputReplayer::InputReplayer(Controller *Target, QObject *parent)
+    : QObject{parent}
+    , _Target(Target)
+    , _NextEvent(0)
+    , _Report({0, 0, 0, 0, false})
+{
+
+}
+
+void InputReplayer::Start(const InputLog_t &Log, const ReplayMode_t Mode){
+    _Log = Log;
+    _NextEvent = 0;
+    _Report = {0, 0, 0, 0, false};
+    /* The replay is started from the event loop, so the caller can
+     * connect Finished() and the window is shown before the first event. */
+    if(Mode == REPLAY_REAL_TIME){
+        QTimer::singleShot(0, this, [this](){
+            _Clock.start();
+            DispatchDueEvents();
+        });
+    }else{
+        QTimer::singleShot(0, this, [this](){
+            _Clock.start();
+            DispatchAllEvents();
+        });
+    }
+}
+
+void InputReplayer::DispatchDueEvents(void){
+    const int NumberOfEvents = _Log.Events.length();
+    const qint64 ElapsedMicroseconds = _Clock.nsecsElapsed() / 1000;
+    // The timestamps are those of the recorded Controller: the first event is replayed at once
+    const auto DueTime = [this](const int Event){
+        return static_cast<qint64>(_Log.Events[Event].Timestamp - _Log.Events.first().Timestamp);
+    };
+
+    while(_NextEvent < NumberOfEvents && DueTime(_NextEvent) <= ElapsedMicroseconds){
+        DispatchEvent(_Log.Events[_NextEvent]);
+        _NextEvent++;
+    }
+
+    if(_NextEvent < NumberOfEvents){
+        const qint64 Delay = (DueTime(_NextEvent) - ElapsedMicroseconds) / 1000;
+        QTimer::singleShot(static_cast<int>(Delay), Qt::PreciseTimer, this, &InputReplayer::DispatchDueEvents);
+    }else{
+        _Report.WallTime = _Clock.nsecsElapsed();
+        emit Finished();
+    }
+}
+
+void InputReplayer::DispatchAllEvents(void){
+    const int NumberOfEvents = _Log.Events.length();
+    while(_NextEvent < NumberOfEvents){
+        DispatchEvent(_Log.Events[_NextEvent]);
+        _NextEvent++;
+    }
+    _Report.WallTime = _Clock.nsecsElapsed();
+    emit Finished();
+}
+
+void InputReplayer::DispatchEvent(const InputEvent_t &Event){
+    QElapsedTimer EventClock;
+    EventClock.start();
+    _Target->HandleTimedInput(Event.Input, Event.Value, Event.Timestamp); // The dwell time follows the recording
+    const qint64 Latency = EventClock.nsecsElapsed();
+
+    _Report.EventsCount++;
+    _Report.HandlingTime += Latency;
+    _Report.MaxLatency = qMax(_Report.MaxLatency, Latency);
+}
+
+ReplayReport_t InputReplayer::GetReport(const QString &ProducedText) const{
+    ReplayReport_t Report = _Report;
+    Report.TextMatches = (ProducedText == _Log.ExpectedText);
+    return Report;
+}
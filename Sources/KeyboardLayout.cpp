@@ -0,0 +1,552 @@
+#include <QDataStream>
+#include <QFile>
+#include <QPair>
+#include <QSet>
+#include <QTextStream>
+
+#include "Headers/KeyboardLayout.h"
+
+/**
+ * @brief The buttons a layout maps, by IconName, with the input triggering them and their built-in features.
+ */
+static const QVector<QPair<const PhysicalButton_t*, GamepadInput_t>> LayoutButtons = {
+    {&Button_X, INPUT_BUTTON_X},
+    {&Button_Y, INPUT_BUTTON_Y},
+    {&Button_LB, INPUT_BUTTON_LB},
+    {&Button_RB, INPUT_BUTTON_RB},
+    {&Button_LT, INPUT_BUTTON_LT},
+    {&Dpad_UP, INPUT_DPAD_UP},
+    {&Dpad_DOWN, INPUT_DPAD_DOWN},
+    {&Dpad_LEFT, INPUT_DPAD_LEFT},
+    {&Dpad_RIGHT, INPUT_DPAD_RIGHT}
+};
+
+/**
+ * @brief The features a button can trigger, by the name of their constant in GP4k_ButtonsMapping.h.
+ */
+static const QVector<QPair<QString, const feature_t*>> LayoutFeatures = {
+    {"BACKSPACE", &BACKSPACE},
+    {"SPACE", &SPACE},
+    {"MOVE_LEFT", &MOVE_LEFT},
+    {"MOVE_RIGHT", &MOVE_RIGHT},
+    {"SHIFT", &SHIFT},
+    {"COMMA", &COMMA},
+    {"PERIOD", &PERIOD},
+    {"EXCLAM", &EXCLAM},
+    {"QUESTION", &QUESTION},
+    {"APOSTROPHE", &APOSTROPHE},
+    {"HYPHEN", &HYPHEN},
+    {"SEMI_COLON", &SEMI_COLON},
+    {"COLON", &COLON},
+    {"NONE", &FEATURE_NONE}
+};
+
+/**
+ * @brief Reads a string of a compiled layout.
+ * @param Stream The stream of the file.
+ * @param Text The string read.
+ * @return False if the stream is truncated or corrupted.
+ */
+static bool ReadBounded(QDataStream &Stream, QString &Text){
+    Stream >> Text; // Read by blocks by QDataStream: a corrupted length fails without allocating it
+    return Stream.status() == QDataStream::Ok;
+}
+
+/**
+ * @brief Reads a number of suggestion tiles of a compiled layout.
+ * @param Stream The stream of the file.
+ * @param Value The number read.
+ * @return False if the stream is truncated.
+ */
+static bool ReadBounded(QDataStream &Stream, uint8_t &Value){
+    Stream >> Value;
+    return Stream.status() == QDataStream::Ok;
+}
+
+/**
+ * @brief Reads a vector of a compiled layout, written by QDataStream, refusing more items than a layout can hold.
+ * @param Stream The stream of the file.
+ * @param Items The items read.
+ * @return False if the stream is truncated or corrupted, or if the count is over NUMBER_OF_TILES.
+ *
+ * @details QDataStream reserves the count written in the file before reading the items: a corrupted count would
+ * allocate gigabytes. No vector of a layout, shift states, groups, tiles or suggestions, is longer than the tiles.
+ */
+template<typename Item_t>
+static bool ReadBounded(QDataStream &Stream, QVector<Item_t> &Items){
+    quint32 Count = 0;
+    Stream >> Count;
+    if(Stream.status() != QDataStream::Ok || Count > NUMBER_OF_TILES){
+        return false;
+    }
+    Items.clear();
+    for(quint32 Index = 0; Index < Count; Index++){
+        Item_t Item;
+        if(!ReadBounded(Stream, Item)){
+            return false;
+        }
+        Items.append(Item);
+    }
+    return true;
+}
+
+/**
+ * @brief Finds a feature from its name.
+ * @param Name The name of its constant in GP4k_ButtonsMapping.h.
+ * @return The feature, nullptr if the name is unknown.
+ */
+static const feature_t* FeatureFromName(const QString &Name){
+    for(const auto &Feature : LayoutFeatures){
+        if(Feature.first == Name){
+            return Feature.second;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Finds the name of a feature.
+ * @param Feature The feature.
+ * @return The name of its constant in GP4k_ButtonsMapping.h, empty for an unknown feature.
+ */
+static QString FeatureName(const feature_t &Feature){
+    for(const auto &Known : LayoutFeatures){
+        if(*Known.second == Feature){
+            return Known.first;
+        }
+    }
+    return QString();
+}
+
+/**
+ * @brief Converts a text of the built-in tables.
+ * @param Text A UTF-8 text.
+ * @return The text.
+ */
+static QString Utf8String(const std::string_view &Text){
+    return QString::fromUtf8(Text.data(), static_cast<int>(Text.size()));
+}
+
+/**
+ * @brief The layout in use. Function-local, so it's built from the tables even when read during a static init.
+ * @return The active layout.
+ */
+static KeyboardLayout &ActiveLayout(void){
+    static KeyboardLayout Layout = KeyboardLayout::Builtin();
+    return Layout;
+}
+
+KeyboardLayout KeyboardLayout::Builtin(void){
+    KeyboardLayout Layout;
+    Layout._InnerTilesChars = {{}, {}};
+    Layout._OuterTilesTexts = {{}, {}};
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+            CharGroup_t Chars;
+            for(uint8_t Tile = 0; Tile < NUMBER_OF_TILES - GroupsSuggestionsMap[Group]; Tile++){
+                Chars.append(Utf8String(InnerTilesChars[Shift][Group][Tile]));
+            }
+            Layout._InnerTilesChars[Shift].append(Chars);
+            Layout._OuterTilesTexts[Shift].append(Utf8String(OuterTilesTexts[Shift][Group]));
+        }
+    }
+    for(const uint8_t Suggestions : GroupsSuggestionsMap){
+        Layout._GroupsSuggestionsMap.append(Suggestions);
+    }
+    Layout._CharIndex = BuiltinCharIndex; // Already checked and computed by the compiler
+    for(const auto &Button : LayoutButtons){
+        Layout._ButtonsFeatures.insert(Button.first->IconName, Button.first->Features);
+    }
+    Layout.BuildLookups();
+    return Layout;
+}
+
+bool KeyboardLayout::Load(const QString &Path, KeyboardLayout &Layout, QStringList &Errors){
+    QFile File(Path);
+    if(!File.open(QIODevice::ReadOnly)){
+        Errors << QString("%1: %2").arg(Path, File.errorString());
+        return false;
+    }
+    const QByteArray Data = File.readAll();
+
+    QDataStream Magic(Data);
+    quint32 FileMagic = 0;
+    Magic >> FileMagic;
+    if(FileMagic == LAYOUT_FILE_MAGIC){
+        return FromBinary(Data, Layout, Errors);
+    }
+    return FromText(QString::fromUtf8(Data), Layout, Errors);
+}
+
+bool KeyboardLayout::FromText(const QString &Text, KeyboardLayout &Layout, QStringList &Errors){
+    KeyboardLayout Parsed;
+    Parsed._InnerTilesChars = {{}, {}};
+    Parsed._OuterTilesTexts = {{}, {}};
+    const int ErrorsBefore = Errors.length();
+
+    // Fields of the current group, to check each one is given exactly once
+    QSet<QString> GroupFields;
+    int GroupLine = 0;
+    const QStringList GroupKeywords = {"lower", "upper", "outer", "outer_upper"};
+    auto CloseGroup = [&](){
+        if(GroupLine > 0 && GroupFields.size() != GroupKeywords.length()){
+            Errors << QString("line %1: the group must have the lines %2").arg(GroupLine).arg(GroupKeywords.join(", "));
+        }
+    };
+
+    const QStringList Lines = Text.split('\n');
+    for(int Index = 0; Index < Lines.length(); Index++){
+        const int LineNumber = Index + 1;
+        const QString Line = Lines[Index].trimmed();
+        if(Line.isEmpty() || Line.startsWith('#')){
+            continue;
+        }
+        const QString Keyword = Line.section(' ', 0, 0, QString::SectionSkipEmpty);
+        const QString Value = Line.mid(Keyword.length()).trimmed();
+        const QStringList Words = Value.split(' ', Qt::SkipEmptyParts);
+
+        if(Keyword == "group"){
+            CloseGroup();
+            bool IsNumber = false;
+            const uint Suggestions = Value.toUInt(&IsNumber);
+            if(!IsNumber || Suggestions >= NUMBER_OF_TILES){ // At least one char tile
+                Errors << QString("line %1: the number of suggestion tiles must be between 0 and %2").arg(LineNumber).arg(MAX_TILE_INDEX);
+            }
+            Parsed._GroupsSuggestionsMap.append(static_cast<uint8_t>(Suggestions));
+            Parsed._InnerTilesChars[NOT_SHIFTED].append({});
+            Parsed._InnerTilesChars[SHIFTED].append({});
+            Parsed._OuterTilesTexts[NOT_SHIFTED].append(QString());
+            Parsed._OuterTilesTexts[SHIFTED].append(QString());
+            GroupFields.clear();
+            GroupLine = LineNumber;
+        }else if(GroupKeywords.contains(Keyword)){
+            if(GroupLine == 0){
+                Errors << QString("line %1: '%2' outside of a group").arg(LineNumber).arg(Keyword);
+                continue;
+            }
+            if(GroupFields.contains(Keyword)){
+                Errors << QString("line %1: '%2' given twice for the group").arg(LineNumber).arg(Keyword);
+            }
+            GroupFields.insert(Keyword);
+            const ShiftState_t Shift = Keyword.endsWith("upper") ? SHIFTED : NOT_SHIFTED;
+            if(Keyword.startsWith("outer")){
+                Parsed._OuterTilesTexts[Shift].last() = Value;
+            }else{
+                Parsed._InnerTilesChars[Shift].last() = Words.toVector();
+            }
+        }else if(Keyword == "button"){
+            if(Words.length() != 3){
+                Errors << QString("line %1: a button is written 'button <NAME> <FEATURE> <SHIFTED FEATURE>'").arg(LineNumber);
+                continue;
+            }
+            if(Parsed._ButtonsFeatures.contains(Words[0])){
+                Errors << QString("line %1: the button %2 is mapped twice").arg(LineNumber).arg(Words[0]);
+            }
+            QVector<feature_t> Features;
+            for(const QString &Name : Words.mid(1)){
+                const feature_t *Feature = FeatureFromName(Name);
+                if(Feature == nullptr){
+                    Errors << QString("line %1: unknown feature %2").arg(LineNumber).arg(Name);
+                    Features.append(FEATURE_NONE);
+                }else{
+                    Features.append(*Feature);
+                }
+            }
+            Parsed._ButtonsFeatures.insert(Words[0], Features);
+        }else{
+            Errors << QString("line %1: unknown keyword '%2'").arg(LineNumber).arg(Keyword);
+        }
+    }
+    CloseGroup();
+
+    if(Errors.length() > ErrorsBefore){ // The tables are incomplete: validating them would only repeat the errors
+        return false;
+    }
+    const QStringList Invalid = Parsed.Validate();
+    if(!Invalid.isEmpty()){
+        Errors << Invalid;
+        return false;
+    }
+    Parsed.BuildLookups();
+    Layout = Parsed;
+    return true;
+}
+
+bool KeyboardLayout::FromBinary(const QByteArray &Data, KeyboardLayout &Layout, QStringList &Errors){
+    QDataStream Stream(Data);
+    Stream.setVersion(QDataStream::Qt_5_15);
+
+    quint32 Magic = 0;
+    quint32 Version = 0;
+    Stream >> Magic >> Version;
+    if(Magic != LAYOUT_FILE_MAGIC || Version != LAYOUT_FILE_VERSION){
+        Errors << QString("not a compiled layout of version %1: recompile it with gp4k-layoutc").arg(LAYOUT_FILE_VERSION);
+        return false;
+    }
+
+    KeyboardLayout Parsed;
+    quint32 ButtonsCount = 0;
+    if(!ReadBounded(Stream, Parsed._InnerTilesChars) || !ReadBounded(Stream, Parsed._OuterTilesTexts)
+       || !ReadBounded(Stream, Parsed._GroupsSuggestionsMap)){
+        Errors << "the compiled layout is truncated or corrupted";
+        return false;
+    }
+    Stream >> ButtonsCount;
+    if(ButtonsCount > static_cast<quint32>(LayoutButtons.length())){
+        Errors << QString("the compiled layout maps %1 buttons, for %2 buttons").arg(ButtonsCount).arg(LayoutButtons.length());
+        return false;
+    }
+    for(quint32 Index = 0; Index < ButtonsCount && Stream.status() == QDataStream::Ok; Index++){
+        QString Name;
+        QString Features[2];
+        Stream >> Name >> Features[NOT_SHIFTED] >> Features[SHIFTED];
+        const feature_t *NotShifted = FeatureFromName(Features[NOT_SHIFTED]);
+        const feature_t *Shifted = FeatureFromName(Features[SHIFTED]);
+        if(NotShifted == nullptr || Shifted == nullptr){
+            Errors << QString("the button %1 has an unknown feature").arg(Name);
+            return false;
+        }
+        Parsed._ButtonsFeatures.insert(Name, {*NotShifted, *Shifted});
+    }
+    if(Stream.status() != QDataStream::Ok || !Stream.atEnd()){
+        Errors << "the compiled layout is truncated or corrupted";
+        return false;
+    }
+    if(Parsed._InnerTilesChars.length() != 2 || Parsed._OuterTilesTexts.length() != 2){
+        Errors << "the compiled layout must hold the tiles of both shift states";
+        return false;
+    }
+
+    const QStringList Invalid = Parsed.Validate();
+    if(!Invalid.isEmpty()){
+        Errors << Invalid;
+        return false;
+    }
+    Parsed.BuildLookups();
+    Layout = Parsed;
+    return true;
+}
+
+bool KeyboardLayout::WithLetters(const QStringList &Groups, KeyboardLayout &Layout, QStringList &Errors) const{
+    if(Groups.length() > GroupsCount()){
+        Errors << QString("%1 letter groups for %2 groups").arg(Groups.length()).arg(GroupsCount());
+        return false;
+    }
+
+    KeyboardLayout Changed = *this;
+    for(int Group = 0; Group < Groups.length(); Group++){
+        CharGroup_t Lower;
+        CharGroup_t Upper;
+        for(const QChar Letter : Groups[Group]){
+            Lower.append(QString(Letter.toLower()));
+            Upper.append(QString(Letter.toUpper()));
+        }
+        Changed._InnerTilesChars[NOT_SHIFTED][Group] = Lower;
+        Changed._InnerTilesChars[SHIFTED][Group] = Upper;
+        Changed._OuterTilesTexts[NOT_SHIFTED][Group] = QStringList(Lower.toList()).join(' ');
+        Changed._OuterTilesTexts[SHIFTED][Group] = QStringList(Upper.toList()).join(' ');
+    }
+    Changed._CharIndex = CharIndex(); // Rebuilt from the new tiles
+
+    const QStringList Invalid = Changed.Validate();
+    if(!Invalid.isEmpty()){
+        Errors << Invalid;
+        return false;
+    }
+    Changed.BuildLookups();
+    Layout = Changed;
+    return true;
+}
+
+QString KeyboardLayout::ToText(void) const{
+    QString Text;
+    QTextStream Out(&Text);
+    Out << "# GP4k layout. Compile it with gp4k-layoutc, or load it as is with --layout.\n";
+    for(int Group = 0; Group < GroupsCount(); Group++){
+        Out << "\ngroup " << static_cast<int>(_GroupsSuggestionsMap[Group]) << "\n"
+            << "lower " << QStringList(_InnerTilesChars[NOT_SHIFTED][Group].toList()).join(' ') << "\n"
+            << "upper " << QStringList(_InnerTilesChars[SHIFTED][Group].toList()).join(' ') << "\n"
+            << "outer " << _OuterTilesTexts[NOT_SHIFTED][Group] << "\n"
+            << "outer_upper " << _OuterTilesTexts[SHIFTED][Group] << "\n";
+    }
+    Out << "\n";
+    for(const auto &Button : LayoutButtons){ // In the order of the header, not of the hash
+        const QVector<feature_t> Features = _ButtonsFeatures.value(Button.first->IconName);
+        Out << "button " << Button.first->IconName << " "
+            << FeatureName(Features[NOT_SHIFTED]) << " " << FeatureName(Features[SHIFTED]) << "\n";
+    }
+    Out.flush();
+    return Text;
+}
+
+QByteArray KeyboardLayout::ToBinary(void) const{
+    QByteArray Data;
+    QDataStream Stream(&Data, QIODevice::WriteOnly);
+    Stream.setVersion(QDataStream::Qt_5_15);
+
+    Stream << quint32(LAYOUT_FILE_MAGIC) << quint32(LAYOUT_FILE_VERSION)
+           << _InnerTilesChars << _OuterTilesTexts << _GroupsSuggestionsMap
+           << quint32(LayoutButtons.length());
+    for(const auto &Button : LayoutButtons){
+        const QVector<feature_t> Features = _ButtonsFeatures.value(Button.first->IconName);
+        Stream << Button.first->IconName << FeatureName(Features[NOT_SHIFTED]) << FeatureName(Features[SHIFTED]);
+    }
+    return Data;
+}
+
+const KeyboardLayout &KeyboardLayout::Active(void){
+    return ActiveLayout();
+}
+
+void KeyboardLayout::SetActive(const KeyboardLayout &Layout){
+    ActiveLayout() = Layout;
+}
+
+const feature_t &KeyboardLayout::ButtonFeature(const QString &ButtonName, const ShiftState_t Shift) const{
+    const auto Button = _ButtonsFeatures.constFind(ButtonName);
+    return (Button == _ButtonsFeatures.constEnd()) ? FEATURE_NONE : Button.value()[Shift];
+}
+
+GamepadInput_t KeyboardLayout::FindInput(const feature_t &Feature, const ShiftState_t Shift) const{
+    for(const auto &Button : LayoutButtons){
+        if(ButtonFeature(Button.second, Shift) == Feature){
+            return Button.second;
+        }
+    }
+    return NUMBER_OF_INPUTS;
+}
+
+bool KeyboardLayout::FindChar(const QChar Character, CharPosition_t &Position) const{
+    const CharIndexEntry_t *Found = _CharIndex.Find(Character.unicode());
+    if(Found == nullptr){
+        return false;
+    }
+    Position = Found->Position;
+    return true;
+}
+
+QStringList KeyboardLayout::Validate(void) const{
+    QStringList Errors;
+
+    if(GroupsCount() != static_cast<int>(NUMBER_OF_TILES) || _InnerTilesChars[SHIFTED].length() != GroupsCount()
+       || _GroupsSuggestionsMap.length() != GroupsCount()){
+        Errors << QString("the layout must have %1 groups, one per outer tile").arg(NUMBER_OF_TILES);
+        return Errors;
+    }
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        if(_OuterTilesTexts[Shift].length() != GroupsCount()){
+            Errors << QString("the layout must have %1 outer texts in each shift state").arg(NUMBER_OF_TILES);
+            return Errors;
+        }
+    }
+
+    // Tile of each text: the same char may only be on the same tile in both shift states, as the emotes
+    QHash<QString, QPair<int, int>> Tiles;
+    for(int Group = 0; Group < GroupsCount(); Group++){
+        if(_GroupsSuggestionsMap[Group] >= NUMBER_OF_TILES){ // LastCharTile would wrap around
+            Errors << QString("group %1: %2 suggestions leave no char tile").arg(Group).arg(_GroupsSuggestionsMap[Group]);
+            continue;
+        }
+        const int CharTiles = NUMBER_OF_TILES - _GroupsSuggestionsMap[Group];
+        for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+            const CharGroup_t &Chars = _InnerTilesChars[Shift][Group];
+            if(Chars.length() != CharTiles){
+                Errors << QString("group %1: %2 chars %3, but %4 tiles are left next to its %5 suggestions")
+                          .arg(Group).arg(Chars.length()).arg(Shift == SHIFTED ? "shifted" : "not shifted")
+                          .arg(CharTiles).arg(_GroupsSuggestionsMap[Group]);
+            }
+            for(int Tile = 0; Tile < Chars.length(); Tile++){
+                const QPair<int, int> Position(Group, Tile);
+                const auto Previous = Tiles.constFind(Chars[Tile]);
+                if(Chars[Tile].isEmpty()){
+                    Errors << QString("group %1: tile %2 is empty").arg(Group).arg(Tile);
+                }else if(Previous != Tiles.constEnd() && Previous.value() != Position){
+                    Errors << QString("'%1' is on two tiles: group %2 tile %3, and group %4 tile %5").arg(Chars[Tile])
+                              .arg(Previous.value().first).arg(Previous.value().second).arg(Group).arg(Tile);
+                }else{
+                    Tiles.insert(Chars[Tile], Position);
+                }
+            }
+        }
+    }
+    for(const QChar Required : QString(LAYOUT_REQUIRED_CHARS)){
+        if(!Tiles.contains(QString(Required))){
+            Errors << QString("'%1' is on no tile").arg(Required);
+        }
+    }
+
+    for(const auto &Button : LayoutButtons){
+        const auto Features = _ButtonsFeatures.constFind(Button.first->IconName);
+        if(Features == _ButtonsFeatures.constEnd() || Features.value().length() != 2){
+            Errors << QString("the button %1 is not mapped").arg(Button.first->IconName);
+        }
+    }
+    for(auto Button = _ButtonsFeatures.constBegin(); Button != _ButtonsFeatures.constEnd(); Button++){
+        bool Known = false;
+        for(const auto &LayoutButton : LayoutButtons){
+            Known = Known || (LayoutButton.first->IconName == Button.key());
+        }
+        if(!Known){
+            Errors << QString("unknown button %1").arg(Button.key());
+        }
+    }
+    if(!Errors.isEmpty()){
+        return Errors;
+    }
+
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        const QString State = (Shift == SHIFTED) ? "shifted" : "not shifted";
+        QSet<QString> Mapped;
+        for(const auto &Button : LayoutButtons){
+            const feature_t &Feature = ButtonFeature(Button.first->IconName, Shift);
+            if(Feature.FeatureType == NO_CHAR_CAT){ // Unmapped: may be on several buttons
+                continue;
+            }
+            if(Mapped.contains(Feature.Text)){
+                Errors << QString("%1 is mapped twice %2").arg(FeatureName(Feature), State);
+            }
+            Mapped.insert(Feature.Text);
+            // The punctuation types Text[1]: a tile typing it too would be a duplicate
+            if((Feature.FeatureType == PUNCTUATION || Feature.FeatureType == WORD_CONNECTOR)
+               && Tiles.contains(Feature.Text.mid(1, 1))){
+                Errors << QString("'%1' is on a tile and on the button %2").arg(Feature.Text.mid(1, 1), Button.first->IconName);
+            }
+        }
+        for(const feature_t *Required : {&SPACE, &BACKSPACE, &SHIFT}){
+            if(!Mapped.contains(Required->Text)){
+                Errors << QString("no button is mapped to %1 %2").arg(FeatureName(*Required), State);
+            }
+        }
+    }
+    return Errors;
+}
+
+void KeyboardLayout::BuildLookups(void){
+    _LastCharTiles.resize(GroupsCount());
+    for(int Group = 0; Group < GroupsCount(); Group++){
+        _LastCharTiles[Group] = MAX_TILE_INDEX - _GroupsSuggestionsMap[Group];
+    }
+
+    _InputFeatures.fill(FEATURE_NONE, NUMBER_OF_INPUTS * 2);
+    for(const auto &Button : LayoutButtons){
+        for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+            _InputFeatures[Button.second * 2 + Shift] = ButtonFeature(Button.first->IconName, Shift);
+        }
+    }
+
+    if(_CharIndex.Size() != 0){ // The built-in index, computed by the compiler
+        return;
+    }
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){ // NOT_SHIFTED first: it wins for the chars on both
+        for(int Group = 0; Group < GroupsCount(); Group++){
+            const CharGroup_t &Chars = _InnerTilesChars[Shift][Group];
+            for(int Tile = 0; Tile < Chars.length(); Tile++){
+                // The emotes followed by a variation selector are two code points: they can't be looked up char by char
+                const QVector<uint> CodePoints = Chars[Tile].toUcs4();
+                if(CodePoints.length() == 1){
+                    _CharIndex.Insert(CodePoints[0], {static_cast<uint8_t>(Group), static_cast<uint8_t>(Tile), Shift});
+                }
+            }
+        }
+    }
+}
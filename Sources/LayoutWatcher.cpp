@@ -0,0 +1,32 @@
+#include <QDebug>
+#include <QStringList>
+
+#include "Headers/KeyboardLayout.h"
+#include "Headers/LayoutWatcher.h"
+
+LayoutWatcher::LayoutWatcher(const QString &Path, QObject *parent)
+    : QObject(parent)
+    , _Path(Path)
+{
+    _Debounce.setSingleShot(true);
+    _Debounce.setInterval(LAYOUT_RELOAD_DELAY_MS);
+    connect(&_Debounce, &QTimer::timeout, this, &LayoutWatcher::Reload);
+    connect(&_Watcher, &QFileSystemWatcher::fileChanged, &_Debounce, QOverload<>::of(&QTimer::start));
+    _Watcher.addPath(_Path);
+}
+
+void LayoutWatcher::Reload(void){
+    // Saving by renaming a temporary file removes the watched one: watch the new file
+    if(!_Watcher.files().contains(_Path)){
+        _Watcher.addPath(_Path);
+    }
+
+    KeyboardLayout Layout;
+    QStringList Errors;
+    if(!KeyboardLayout::Load(_Path, Layout, Errors)){
+        qWarning().noquote().nospace() << "Layout " << _Path << " not reloaded, the previous one is kept:\n    " << Errors.join("\n    ");
+        return;
+    }
+    KeyboardLayout::SetActive(Layout);
+    emit LayoutChanged();
+}
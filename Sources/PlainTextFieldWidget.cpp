@@ -0,0 +1,60 @@
+#include "Headers/PlainTextFieldWidget.h"
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
+#include "Headers/Trace.h"
+
+PlainTextFieldWidget::PlainTextFieldWidget(QWidget *parent)
+    : QPlainTextEdit(parent)
+    , _IsEditing(false)
+{
+    QFont font;
+    font.setFamily(GLOBAL_FONT);
+    font.setPointSize(GuiScale::FontSize());
+    setFont(font);
+}
+
+void PlainTextFieldWidget::SetGeometryOnGrid(const placement_t WidgetPlacement){
+    QWidget::setGeometry(GuiScale::ToPixels(WidgetPlacement));
+}
+
+void PlainTextFieldWidget::BeginEditBlock(void){
+    if(!_IsEditing){
+        _Cursor = textCursor();
+        _Cursor.beginEditBlock();
+        _IsEditing = true;
+    }
+}
+
+void PlainTextFieldWidget::EndEditBlock(void){
+    if(_IsEditing){
+        GP4K_TRACE_SPAN(TRACE_DETAIL, "PlainTextFieldWidget::EndEditBlock");
+        _Cursor.endEditBlock();
+        setTextCursor(_Cursor);
+        _IsEditing = false;
+    }
+}
+
+void PlainTextFieldWidget::InsertText(const QString &Text){
+    BeginEditBlock();
+    _Cursor.insertText(Text);
+}
+
+void PlainTextFieldWidget::OrderReceived(const Qt::Key Key){
+    BeginEditBlock();
+    switch (Key) {
+    case Qt::Key_Space:
+        _Cursor.insertText(" ");
+        break;
+    case Qt::Key_Backspace:
+        _Cursor.deletePreviousChar(); // A whole emote, as the key event did
+        break;
+    case Qt::Key_Left:
+        _Cursor.movePosition(QTextCursor::PreviousCharacter);
+        break;
+    case Qt::Key_Right:
+        _Cursor.movePosition(QTextCursor::NextCharacter);
+        break;
+    default: // No other order is sent by the Controller
+        break;
+    }
+}
@@ -0,0 +1,43 @@
+#include <QGuiApplication>
+#include <QImageReader>
+#include <QTransform>
+
+#include "Headers/RasterAtlas.h"
+
+const QPixmap& RasterAtlas::Get(const QString &File, const QSize &Size, const Qt::AspectRatioMode AspectMode, const int Angle){
+    const QString Key = QString("%1@%2x%3/%4/%5").arg(File).arg(Size.width()).arg(Size.height()).arg(AspectMode).arg(Angle);
+    auto Image = _Images.find(Key);
+    if(Image == _Images.end()){
+        Image = _Images.insert(Key, Rasterize(File, Size, AspectMode, Angle));
+    }
+    return Image.value();
+}
+
+int RasterAtlas::GetRasterizationsCount(void){
+    return _RasterizationsCount;
+}
+
+QPixmap RasterAtlas::Rasterize(const QString &File, const QSize &Size, const Qt::AspectRatioMode AspectMode, const int Angle){
+    QImageReader Reader(File);
+    if(!Reader.canRead()){
+        return QPixmap();
+    }
+
+    const qreal PixelRatio = qApp->devicePixelRatio();
+    const QSize NativeSize = Reader.size(); // Invalid if the format can't tell it without decoding
+    Reader.setScaledSize((NativeSize.isValid() ? NativeSize.scaled(Size, AspectMode) : Size) * PixelRatio);
+    QImage Image = Reader.read();
+    _RasterizationsCount++;
+    if(Image.isNull()){
+        return QPixmap();
+    }
+
+    if(Angle != 0){ // Multiples of 90°: no resampling
+        QTransform RotationTransform;
+        RotationTransform.rotate(Angle);
+        Image = Image.transformed(RotationTransform);
+    }
+    QPixmap Pixmap = QPixmap::fromImage(Image);
+    Pixmap.setDevicePixelRatio(PixelRatio);
+    return Pixmap;
+}
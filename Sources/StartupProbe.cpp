@@ -0,0 +1,34 @@
+#include <QDebug>
+#include <QEvent>
+
+#include "Headers/StartupProbe.h"
+
+StartupProbe::StartupProbe(const QElapsedTimer &Clock, QWidget *Window, Controller *Target, QObject *parent)
+    : QObject{parent}
+    , _Clock(Clock)
+    , _FirstFrame(-1)
+    , _FirstSuggestion(-1)
+{
+    Window->installEventFilter(this);
+    connect(Target, &Controller::DictionaryReady, this, [this](){
+        _FirstSuggestion = _Clock.nsecsElapsed();
+        qInfo() << "Time to first suggestion:" << _FirstSuggestion / 1e6 << "ms";
+        CheckFinished();
+    });
+}
+
+bool StartupProbe::eventFilter(QObject *Watched, QEvent *Event){
+    if(Event->type() == QEvent::Paint && _FirstFrame == -1){
+        _FirstFrame = _Clock.nsecsElapsed();
+        qInfo() << "Time to first frame:" << _FirstFrame / 1e6 << "ms";
+        Watched->removeEventFilter(this);
+        CheckFinished();
+    }
+    return false;
+}
+
+void StartupProbe::CheckFinished(void){
+    if(_FirstFrame != -1 && _FirstSuggestion != -1){
+        emit Finished();
+    }
+}
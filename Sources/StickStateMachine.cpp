@@ -0,0 +1,134 @@
+#include <cmath>
+
+#include "Headers/StickStateMachine.h"
+
+/**
+ * @def TILE_ANGLE
+ * @brief The angle covered by a tile, in degree.
+ */
+#define TILE_ANGLE 45.0
+
+/**
+ * @def HALF_TILE_ANGLE
+ * @brief Half the angle covered by a tile, in degree: the distance between the center of a tile and its edges.
+ */
+#define HALF_TILE_ANGLE 22.5
+
+StickStateMachine::StickStateMachine(const uint8_t InitialTile, const StickThresholds_t Thresholds)
+    : _Thresholds(Thresholds)
+    , _Position(CENTER)
+    , _Tile(InitialTile)
+    , _PendingTile(DEFAULT_TILE)
+    , _PendingSince(0)
+    , _SingleThresholdPosition(CENTER)
+    , _SingleThresholdTile(InitialTile)
+    , _Metrics({0, 0, 0, 0, 0})
+{
+
+}
+
+uint8_t StickStateMachine::SectorOf(const double Angle){
+    const double MovedAngle = std::fmod(Angle + HALF_TILE_ANGLE, 360.0);
+    return static_cast<uint8_t>(MovedAngle / TILE_ANGLE) % 8U;
+}
+
+uint8_t StickStateMachine::HystereticSectorOf(const double Angle) const{
+    const uint8_t Tile = _Tile;
+    if(Tile == DEFAULT_TILE){
+        return SectorOf(Angle);
+    }
+    // Distance between the stick and the center of the selected tile, in [0, 180]
+    const double Distance = std::fabs(std::remainder(Angle - Tile * TILE_ANGLE, 360.0));
+    return (Distance <= HALF_TILE_ANGLE + _Thresholds.SectorHysteresis) ? Tile : SectorOf(Angle);
+}
+
+void StickStateMachine::UpdateSingleThresholdMetrics(const double Radius, const double Angle){
+    const StickPosition_t Position = (Radius >= SINGLE_THRESHOLD_RADIUS) ? BORDER : CENTER;
+    if(Position == BORDER){
+        const uint8_t Tile = SectorOf(Angle);
+        if(Tile != _SingleThresholdTile){
+            _SingleThresholdTile = Tile;
+            _Metrics.SingleThresholdTileChanges++;
+        }
+    }else if(_SingleThresholdPosition == BORDER){
+        _Metrics.SingleThresholdReleases++;
+    }
+    _SingleThresholdPosition = Position;
+}
+
+uint8_t StickStateMachine::Update(const double X, const double Y, const qint64 Timestamp){
+    const double Radius = std::hypot(X, Y);
+    const double Angle = std::atan2(Y, X) * 180.0 / M_PI + 180.0;
+    UpdateSingleThresholdMetrics(Radius, Angle);
+
+    uint8_t Events = STICK_NO_EVENT;
+
+    if(_Position == CENTER){
+        if(Radius >= _Thresholds.EnterRadius){
+            _Position = BORDER;
+            const uint8_t Tile = SectorOf(Angle); // No hysteresis nor dwell when leaving the center: it's a new move
+            if(Tile != _Tile){
+                _Tile = Tile;
+                Events |= STICK_TILE_CHANGED;
+            }
+        }
+    }else if(Radius < _Thresholds.ExitRadius){
+        // A pending tile is only selected if it was pointed long enough before the release
+        if(_PendingTile != DEFAULT_TILE){
+            if(Timestamp - _PendingSince >= _Thresholds.DwellTime){
+                _Tile = _PendingTile;
+                Events |= STICK_TILE_CHANGED;
+            }else{
+                _Metrics.DwellRejections++;
+            }
+            _PendingTile = DEFAULT_TILE;
+        }
+        _Position = CENTER;
+        Events |= STICK_RELEASED;
+    }else if(Radius >= _Thresholds.EnterRadius){ // Between the two radius, the angle is not reliable enough
+        const uint8_t Tile = HystereticSectorOf(Angle);
+        if(Tile == _Tile){
+            if(_PendingTile != DEFAULT_TILE){ // Back to the selected tile before the dwell time
+                _Metrics.DwellRejections++;
+                _PendingTile = DEFAULT_TILE;
+            }
+        }else if(_Thresholds.DwellTime == 0){
+            _Tile = Tile;
+            Events |= STICK_TILE_CHANGED;
+        }else if(Tile != _PendingTile){
+            if(_PendingTile != DEFAULT_TILE){
+                _Metrics.DwellRejections++;
+            }
+            _PendingTile = Tile;
+            _PendingSince = Timestamp;
+        }else if(Timestamp - _PendingSince >= _Thresholds.DwellTime){
+            _Tile = Tile;
+            _PendingTile = DEFAULT_TILE;
+            Events |= STICK_TILE_CHANGED;
+        }
+    }
+
+    if(Events & STICK_TILE_CHANGED){ _Metrics.TileChanges++; }
+    if(Events & STICK_RELEASED){ _Metrics.Releases++; }
+    return Events;
+}
+
+uint8_t StickStateMachine::GetTile(void) const{
+    return _Tile;
+}
+
+void StickStateMachine::ResetTile(void){
+    _Tile = DEFAULT_TILE;
+    _PendingTile = DEFAULT_TILE;
+    _SingleThresholdTile = DEFAULT_TILE;
+}
+
+void StickStateMachine::Center(void){
+    _Position = CENTER;
+    _PendingTile = DEFAULT_TILE;
+    _SingleThresholdPosition = CENTER;
+}
+
+StickMetrics_t StickStateMachine::GetMetrics(void) const{
+    return _Metrics;
+}
@@ -0,0 +1,109 @@
+#include <algorithm>
+
+#include "Headers/SwipeDecoder.h"
+#include "Headers/GP4k_Typedefs.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/Trace.h"
+
+/**
+ * @brief A partial word of the decoding.
+ */
+struct Hypothesis_t {
+    const TrieNode *Node; /**< The node reached by the letters of the word. */
+    int PathIndex;        /**< The visited tile matched by the last letter, -1 before the first letter. */
+    QString Word;         /**< The letters so far. */
+};
+
+SwipeDecoder::SwipeDecoder(const QSharedPointer<const Trie> &Dictionary)
+    : _Trie(Dictionary)
+{
+    ReloadKeys();
+}
+
+void SwipeDecoder::ReloadKeys(void){
+    // Both shift states: a shifted char is on the tile of its unshifted one, which a swipe can't tell apart
+    _Keys.clear();
+    for(const CharIndexEntry_t &Entry : KeyboardLayout::Active().Chars()){
+        if(Entry.CodePoint <= 0xFFFFU){ // The text is read by QChar
+            _Keys.insert(QChar(static_cast<ushort>(Entry.CodePoint)), {Entry.Position.Group, Entry.Position.Tile});
+        }
+    }
+}
+
+void SwipeDecoder::SetDictionary(const QSharedPointer<const Trie> &Dictionary){
+    _Trie = Dictionary;
+}
+
+QVector<QString> SwipeDecoder::Decode(const QVector<SwipeKey_t> &Path, const QString &Prefix) const{
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "SwipeDecoder::Decode");
+    QVector<QString> Candidates;
+    if(Path.isEmpty() || _Trie.isNull()){
+        return Candidates;
+    }
+
+    const TrieNode *PrefixNode = _Trie->GetRoot();
+    for(const QChar &Letter : Prefix){
+        PrefixNode = PrefixNode->_Children.value(Letter, nullptr);
+        if(PrefixNode == nullptr){ // No words with this prefix
+            return Candidates;
+        }
+    }
+
+    const int LastIndex = Path.size() - 1;
+
+    /* A visit in another group than the previous one was reached on
+     * purpose with the left stick: no letter can skip it. */
+    QVector<int> NextAnchor(Path.size(), LastIndex);
+    for(int Index = LastIndex - 1; Index >= 0; Index--){
+        NextAnchor[Index] = (Path[Index + 1].Group != Path[Index].Group) ? Index + 1 : NextAnchor[Index + 1];
+    }
+
+    QVector<QPair<quint32, QString>> RankedWords;
+    QVector<Hypothesis_t> Beam = {{PrefixNode, -1, Prefix}};
+    QVector<Hypothesis_t> NextBeam;
+
+    while(!Beam.isEmpty()){
+        NextBeam.clear();
+        for(const Hypothesis_t &Current : Beam){
+            for(auto NodeIterator = Current.Node->_Children.cbegin(); NodeIterator != Current.Node->_Children.cend(); ++NodeIterator){
+                const auto Key = _Keys.constFind(NodeIterator.key());
+                if(Key == _Keys.cend()){ // Not on a tile: can't be swiped
+                    continue;
+                }
+                /* The earliest visit of the letter's tile is always the best
+                 * choice: it leaves the most visits for the next letters. The
+                 * first letter must be the first visit, and a double letter
+                 * stays on the same visit. */
+                int PathIndex = qMax(Current.PathIndex, 0);
+                const int LastAllowedIndex = (Current.PathIndex == -1) ? 0 : NextAnchor[Current.PathIndex];
+                while(PathIndex <= LastAllowedIndex && !(Path[PathIndex] == Key.value())){
+                    PathIndex++;
+                }
+                if(PathIndex > LastAllowedIndex){
+                    continue;
+                }
+                NextBeam.append({NodeIterator.value(), PathIndex, Current.Word + NodeIterator.key()});
+            }
+        }
+
+        if(NextBeam.size() > SWIPE_BEAM_WIDTH){
+            std::partial_sort(NextBeam.begin(), NextBeam.begin() + SWIPE_BEAM_WIDTH, NextBeam.end(),
+                              [](const Hypothesis_t &A, const Hypothesis_t &B){ return A.Node->_BestRank < B.Node->_BestRank; });
+            NextBeam.resize(SWIPE_BEAM_WIDTH);
+        }
+
+        for(const Hypothesis_t &Next : NextBeam){
+            if(Next.Node->_IsEndOfWord && Next.PathIndex == LastIndex){
+                RankedWords.append({Next.Node->_WordRank, Next.Word});
+            }
+        }
+        Beam.swap(NextBeam);
+    }
+
+    std::sort(RankedWords.begin(), RankedWords.end(),
+              [](const QPair<quint32, QString> &A, const QPair<quint32, QString> &B){ return A.first < B.first; });
+    for(int Index = 0; Index < RankedWords.size() && Index < SWIPE_MAX_CANDIDATES; Index++){
+        Candidates.append(RankedWords[Index].second);
+    }
+    return Candidates;
+}
@@ -0,0 +1,60 @@
+#include <QTextBoundaryFinder>
+
+#include "Headers/TextBuffer.h"
+
+TextBuffer::TextBuffer(QObject *parent)
+    : QObject{parent}
+    , _Cursor(0)
+{
+
+}
+
+void TextBuffer::InsertText(const QString &Text){
+    _Text.insert(_Cursor, Text);
+    _Cursor += Text.length();
+}
+
+void TextBuffer::OrderReceived(const Qt::Key Key){
+    switch (Key) {
+    case Qt::Key_Space:
+        InsertText(" ");
+        break;
+    case Qt::Key_Backspace:{
+        const int Boundary = NextBoundary(false);
+        _Text.remove(Boundary, _Cursor - Boundary);
+        _Cursor = Boundary;
+        break;
+    }
+    case Qt::Key_Left:
+        _Cursor = NextBoundary(false);
+        break;
+    case Qt::Key_Right:
+        _Cursor = NextBoundary(true);
+        break;
+    default: // No other order is sent by the Controller
+        break;
+    }
+}
+
+QString TextBuffer::Text(void) const{
+    return _Text;
+}
+
+int TextBuffer::Cursor(void) const{
+    return _Cursor;
+}
+
+void TextBuffer::Clear(void){
+    _Text.clear();
+    _Cursor = 0;
+}
+
+int TextBuffer::NextBoundary(const bool Forward) const{
+    if((Forward && _Cursor == _Text.length()) || (!Forward && _Cursor == 0)){
+        return _Cursor;
+    }
+    QTextBoundaryFinder Finder(QTextBoundaryFinder::Grapheme, _Text);
+    Finder.setPosition(_Cursor);
+    const int Boundary = Forward ? Finder.toNextBoundary() : Finder.toPreviousBoundary();
+    return (Boundary < 0) ? _Cursor : Boundary;
+}
@@ -1,5 +1,6 @@
 #include "Headers/TextFieldWidget.h"
 #include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
 #include "qapplication.h"
 #include "qevent.h"
 
@@ -9,16 +10,12 @@ QTextEditCustom::QTextEditCustom(QWidget *parent)
 {
     QFont font;
     font.setFamily(GLOBAL_FONT);
-    font.setPointSize(GLOBAL_FONT_SIZE);
+    font.setPointSize(GuiScale::FontSize());
     setFont(font);
 }
 
 void QTextEditCustom::SetGeometryOnGrid(placement_t WidgetPlacement){
-    int X = WidgetPlacement.X*CELL_SIZE;
-    int Y = WidgetPlacement.Y*CELL_SIZE;
-    int SizeX = WidgetPlacement.SizeX*CELL_SIZE;
-    int SizeY = WidgetPlacement.SizeY*CELL_SIZE;
-    QWidget::setGeometry(X, Y, SizeX, SizeY);
+    QWidget::setGeometry(GuiScale::ToPixels(WidgetPlacement));
 }
 
 void QTextEditCustom::OrderReceived(const Qt::Key Key){
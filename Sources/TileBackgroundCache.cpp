@@ -0,0 +1,60 @@
+#include <QFile>
+
+#include "Headers/TileBackgroundCache.h"
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
+#include "Headers/RasterAtlas.h"
+
+/**
+ * @brief The rotation of the background of each tile, so the project doesn't require one *.svg per tile.
+ */
+static const QVector<int> TileAngles{0, 0, 90, 90, 180, 180, 270, 270};
+
+const QPixmap& TileBackgroundCache::Get(const radius_t Radius, const uint8_t Index, const TileState_t State){
+    return Backgrounds()[Radius][Index][State];
+}
+
+int TileBackgroundCache::GetRasterizationsCount(void){
+    return RasterAtlas::GetRasterizationsCount();
+}
+
+QString TileBackgroundCache::BackgroundFile(const radius_t Radius, const uint8_t Index, const TileState_t State){
+    QString File = QString(":/Resources/tile_");
+    File.append((Radius == INNER) ? "inner_" : "outer_");
+    File.append((Index % 2 == 0) ? "axes" : "diag");
+    if(State == TILE_SELECTED){
+        File.append("_selected");
+    }else if(State == TILE_UNAVAILABLE){
+        File.append("_unavailable");
+    }
+    File.append(".svg");
+    return File;
+}
+
+QPixmap TileBackgroundCache::Rasterize(const QString &File, const radius_t Radius, const uint8_t Index){
+    if(!QFile::exists(File)){
+        return QPixmap();
+    }
+    const QSize TileSize = GuiScale::ToPixels(TileGroupsPlacements[Radius][Index]).size();
+    const QPixmap Background = RasterAtlas::Get(File, TileSize, Qt::IgnoreAspectRatio, TileAngles[Index]);
+    Q_ASSERT(!Background.isNull());
+    return Background;
+}
+
+const QVector<QVector<QVector<QPixmap>>>& TileBackgroundCache::Backgrounds(void){
+    static const QVector<QVector<QVector<QPixmap>>> Cache = [](){
+        QVector<QVector<QVector<QPixmap>>> Backgrounds(2, QVector<QVector<QPixmap>>(NUMBER_OF_TILES, QVector<QPixmap>(NUMBER_OF_TILE_STATES)));
+        for(const radius_t Radius : {INNER, OUTER}){
+            for(uint8_t Index = 0; Index < NUMBER_OF_TILES; Index++){
+                for(uint8_t State = TILE_NORMAL; State < NUMBER_OF_TILE_STATES; State++){
+                    const TileState_t TileState = static_cast<TileState_t>(State);
+                    QPixmap Background = Rasterize(BackgroundFile(Radius, Index, TileState), Radius, Index);
+                    // The outer tiles are never unavailable, and have no such background
+                    Backgrounds[Radius][Index][State] = Background.isNull() ? Backgrounds[Radius][Index][TILE_NORMAL] : Background;
+                }
+            }
+        }
+        return Backgrounds;
+    }();
+    return Cache;
+}
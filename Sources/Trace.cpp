@@ -0,0 +1,122 @@
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include <QFile>
+#include <QTextStream>
+
+#include "Headers/Trace.h"
+
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be a power of 2");
+
+/**
+ * @brief The start of the process, origin of the timestamps.
+ */
+static const std::chrono::steady_clock::time_point TraceOrigin = std::chrono::steady_clock::now();
+
+/**
+ * @brief Every ring created so far. Never freed: a worker thread may still record while the process exits.
+ */
+static std::vector<TraceRing*> &Rings = *new std::vector<TraceRing*>();
+
+/**
+ * @brief Guards Rings. Only taken when a thread records its first event, and by the export.
+ */
+static std::mutex RingsMutex;
+
+/**
+ * @brief Creates the ring of the calling thread, at its first event.
+ * @return The ring of the calling thread.
+ */
+static TraceRing* CurrentRing(void){
+    thread_local TraceRing *Ring = [](){
+        const std::lock_guard<std::mutex> Lock(RingsMutex);
+        Rings.push_back(new TraceRing(static_cast<int>(Rings.size()) + 1));
+        return Rings.back();
+    }();
+    return Ring;
+}
+
+TraceRing::TraceRing(const int ThreadId)
+    : _ThreadId(ThreadId)
+    , _Written(0)
+{
+    for(TraceSlot_t &Slot : _Slots){
+        Slot.Sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+void TraceRing::Push(const TraceEvent_t &Event){
+    const uint64_t Written = _Written.load(std::memory_order_relaxed);
+    TraceSlot_t &Slot = _Slots[Written & (TRACE_RING_SIZE - 1)];
+    Slot.Sequence.store(2 * Written + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // The odd number is seen before any new field
+    Slot.Name.store(Event.Name, std::memory_order_relaxed);
+    Slot.Start.store(Event.Start, std::memory_order_relaxed);
+    Slot.Duration.store(Event.Duration, std::memory_order_relaxed);
+    Slot.Type.store(Event.Type, std::memory_order_relaxed);
+    Slot.Sequence.store(2 * Written + 2, std::memory_order_release);
+    _Written.store(Written + 1, std::memory_order_release);
+}
+
+void TraceRing::AppendChromeEvents(QString &Json, bool &IsFirst) const{
+    const uint64_t Written = _Written.load(std::memory_order_acquire);
+    const uint64_t First = (Written > TRACE_RING_SIZE) ? Written - TRACE_RING_SIZE : 0;
+    QVector<TraceEvent_t> Events;
+    Events.reserve(static_cast<int>(Written - First));
+    for(uint64_t Index = First; Index < Written; Index++){
+        const TraceSlot_t &Slot = _Slots[Index & (TRACE_RING_SIZE - 1)];
+        const uint64_t Expected = 2 * Index + 2;
+        if(Slot.Sequence.load(std::memory_order_acquire) != Expected){ // Being overwritten, or already
+            continue;
+        }
+        const TraceEvent_t Event = {Slot.Name.load(std::memory_order_relaxed), Slot.Start.load(std::memory_order_relaxed),
+                                    Slot.Duration.load(std::memory_order_relaxed), Slot.Type.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire); // The fields are read before the sequence is checked again
+        if(Slot.Sequence.load(std::memory_order_relaxed) == Expected){ // Not rewritten while copied
+            Events.append(Event);
+        }
+    }
+
+    for(int Index = 0; Index < Events.size(); Index++){
+        const TraceEvent_t &Event = Events[Index];
+        Json.append(IsFirst ? "\n" : ",\n");
+        IsFirst = false;
+        // Chrome traces are in microseconds
+        Json.append(QString("{\"name\":\"%1\",\"cat\":\"gp4k\",\"pid\":1,\"tid\":%2,\"ts\":%3")
+                        .arg(QString::fromLatin1(Event.Name)).arg(_ThreadId).arg(Event.Start / 1000.0, 0, 'f', 3));
+        if(Event.Type == TRACE_SPAN){
+            Json.append(QString(",\"ph\":\"X\",\"dur\":%1}").arg(Event.Duration / 1000.0, 0, 'f', 3));
+        }else{
+            Json.append(",\"ph\":\"i\",\"s\":\"t\"}");
+        }
+    }
+}
+
+void Trace::Record(const TraceEventType_t Type, const char *Name, const int64_t Start, const int64_t Duration){
+    CurrentRing()->Push({Name, Start, Duration, Type});
+}
+
+int64_t Trace::Now(void){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - TraceOrigin).count();
+}
+
+bool Trace::ExportChromeJson(const QString &FilePath){
+    QString Json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool IsFirst = true;
+    {
+        const std::lock_guard<std::mutex> Lock(RingsMutex);
+        for(const TraceRing *Ring : Rings){
+            Ring->AppendChromeEvents(Json, IsFirst);
+        }
+    }
+    Json.append("\n]}\n");
+
+    QFile TraceFile(FilePath);
+    if(!TraceFile.open(QIODevice::WriteOnly | QIODevice::Text)){
+        return false;
+    }
+    QTextStream Stream(&TraceFile);
+    Stream << Json;
+    return Stream.status() == QTextStream::Ok;
+}
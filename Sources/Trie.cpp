@@ -1,20 +1,29 @@
+#include <QDebug>
 #include <QFile>
+#include <QtConcurrent/QtConcurrent>
 #include <QTextStream>
 #include "Headers/Trie.h"
 #include "Headers/GP4k_TilesMapping.h"
-#include "qdebug.h"
+#include "Headers/Trace.h"
 
-TrieNode::TrieNode() : _IsEndOfWord(false) {}
+TrieNode::TrieNode() : _IsEndOfWord(false), _WordRank(UNRANKED), _BestRank(UNRANKED) {}
 
 TrieNode::~TrieNode() {
     qDeleteAll(_Children);
 }
 
-Trie::Trie() {
+Trie::Trie() : Trie(":/Resources/trie_word_list.txt") {}
+
+Trie::Trie(const QString &WordListPath) {
+    GP4K_TRACE_SPAN(TRACE_EVENTS, "Trie::Build");
     _Root = new TrieNode();
-    QFile WordListFile(":/Resources/trie_word_list.txt");
-    qDebug() << "Opening Trie words list...";
-    Q_ASSERT(WordListFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    _WordsCount = 0;
+    QFile WordListFile(WordListPath);
+    _IsLoaded = WordListFile.open(QIODevice::ReadOnly | QIODevice::Text);
+    if(!_IsLoaded){
+        qCritical() << "Cannot open the words list" << WordListPath << ": the dictionary is empty";
+        return;
+    }
     QTextStream WordListStream(&WordListFile);
     QString Word;
     while (!WordListStream.atEnd()){
@@ -27,13 +36,33 @@ Trie::~Trie() {
     delete _Root;
 }
 
+bool Trie::IsLoaded(void) const {
+    return _IsLoaded;
+}
+
+QSharedPointer<const Trie> Trie::Shared(void) {
+    // Initialization of a static local is thread-safe: concurrent first calls still build a single Trie
+    static const QSharedPointer<const Trie> SharedTrie(new Trie());
+    return SharedTrie;
+}
+
+QFuture<QSharedPointer<const Trie>> Trie::SharedAsync(void) {
+    static const QFuture<QSharedPointer<const Trie>> Building = QtConcurrent::run(&Trie::Shared);
+    return Building;
+}
+
 void Trie::Insert(const QString &Word) {
+    const quint32 Rank = _WordsCount++;
     TrieNode *CurrentNode = _Root;
     for (const QChar &Letter : Word) {
         if (!(CurrentNode->_Children.contains(Letter))) {
             CurrentNode->_Children[Letter] = new TrieNode();
         }
         CurrentNode = CurrentNode->_Children[Letter];
+        CurrentNode->_BestRank = qMin(CurrentNode->_BestRank, Rank);
+    }
+    if (!CurrentNode->_IsEndOfWord) { // An inserted again word keeps its first rank
+        CurrentNode->_WordRank = Rank;
     }
     CurrentNode->_IsEndOfWord = true;
 }
@@ -41,24 +70,42 @@ void Trie::Insert(const QString &Word) {
 bool Trie::Search(const QString &Word) const {
     TrieNode *CurrentNode = _Root;
     for (const QChar &Letter : Word) {
-        if (!CurrentNode->_Children.contains(Letter)) {
+        CurrentNode = CurrentNode->_Children.value(Letter, nullptr);
+        if (CurrentNode == nullptr) {
             return false;
         }
-        CurrentNode = CurrentNode->_Children[Letter];
     }
     return CurrentNode->_IsEndOfWord;
 }
 
-QVector<QString> Trie::Suggest(const QString &Prefix, const CharGroup_t SkipLastChar) const {
+/**
+ * @brief Checks a char is one of the tiles of a group, without building a QString per tile as QVector::contains.
+ * @param Tiles The texts of the tiles.
+ * @param Letter The char.
+ * @return True if a tile holds exactly the char.
+ */
+static bool IsTileChar(const CharGroup_t &Tiles, const QChar Letter){
+    for (const QString &Text : Tiles) {
+        if (Text.length() == 1 && Text[0] == Letter) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QVector<QString> Trie::Suggest(const QString &Prefix, const CharGroup_t &SkipLastChar) const {
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "Trie::Suggest");
     QVector<QString> Suggestions;
     TrieNode *CurrentNode = _Root;
     const QString Buffer = Prefix;
 
+    /* Only const accesses to the nodes: the Trie is read by the
+     * prefetching threads of the Autocomplete while it's queried. */
     for (const QChar &Letter : Prefix) {
-        if (!CurrentNode->_Children.contains(Letter)) { // No words with this prefix
+        CurrentNode = CurrentNode->_Children.value(Letter, nullptr);
+        if (CurrentNode == nullptr) { // No words with this prefix
             return Suggestions;
         }
-        CurrentNode = CurrentNode->_Children[Letter];
     }
     SuggestHelper(CurrentNode, Prefix, Suggestions, Buffer, SkipLastChar);
     return Suggestions;
@@ -72,12 +119,12 @@ void Trie::SuggestHelper(TrieNode *Node, const QString &Prefix, QVector<QString>
     QChar LastLetter = Prefix[Prefix.length()-1];
     if (Node->_IsEndOfWord // To suggest a complete word
      && Prefix != Buffer // To prevent suggesting exactly what's already typed
-     && !(SkipLastChar.contains(LastLetter) && Prefix.length() == Buffer.length()+1) // To prevent suggesting a word that is on char away in the same group
+     && !(Prefix.length() == Buffer.length()+1 && IsTileChar(SkipLastChar, LastLetter)) // To prevent suggesting a word that is on char away in the same group
      ){
         Suggestions.append(Prefix);
     }
 
-    for (auto NodeIterator = Node->_Children.begin(); NodeIterator != Node->_Children.end(); ++NodeIterator) {
+    for (auto NodeIterator = Node->_Children.cbegin(); NodeIterator != Node->_Children.cend(); ++NodeIterator) {
         SuggestHelper(NodeIterator.value(), Prefix + NodeIterator.key(), Suggestions, Buffer, SkipLastChar);
         if (Suggestions.size() >= MAX_SUGGESTIONS) { // Stop early if we have enough results
             return;
@@ -104,3 +151,7 @@ bool Trie::SearchAndInsert(const QString &Word) {
 
     return false; // Word already exists
 }
+
+const TrieNode* Trie::GetRoot(void) const {
+    return _Root;
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+
+#include <QDebug>
+#include <QFile>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QVector>
+
+#include "Headers/TypingStats.h"
+
+/**
+ * @brief The index of a letter in the counts.
+ * @param Character A character, in any case.
+ * @return Its index from 'a', -1 if it isn't a letter of 'a' to 'z'.
+ */
+static int StatsLetter(const QChar Character){
+    const ushort Code = Character.toLower().unicode();
+    return (Code >= 'a' && Code <= 'z') ? Code - 'a' : -1;
+}
+
+TypingStats::TypingStats(const QString &Path, QObject *parent)
+    : QObject(parent)
+    , _Path(Path)
+    , _LetterCounts{}
+    , _BigramCounts{}
+    , _Dirty(false)
+{
+    if(!Load()){
+        qWarning() << "Cannot read the typing statistics" << _Path << ": they start from zero";
+    }
+    _FlushTimer.setInterval(STATS_FLUSH_INTERVAL_MS);
+    connect(&_FlushTimer, &QTimer::timeout, this, [this](){
+        if(_Dirty){
+            Save();
+        }
+    });
+    _FlushTimer.start();
+}
+
+TypingStats::~TypingStats(){
+    if(_Dirty){
+        Save();
+    }
+}
+
+bool TypingStats::Load(void){
+    QFile File(_Path);
+    if(!File.exists()){
+        return true;
+    }
+    if(!File.open(QIODevice::ReadOnly | QIODevice::Text)){
+        return false;
+    }
+    QTextStream In(&File);
+    while(!In.atEnd()){
+        const QString Line = In.readLine();
+        const int Tab = Line.indexOf('\t');
+        bool Valid = false;
+        const quint64 Count = Line.mid(Tab + 1).toULongLong(&Valid);
+        if(!Valid){
+            continue;
+        }
+        const int First = (Tab >= 1) ? StatsLetter(Line[0]) : -1;
+        const int Second = (Tab == 2) ? StatsLetter(Line[1]) : -1;
+        if(Tab == 1 && First >= 0){
+            _LetterCounts[First] += Count;
+        }else if(Tab == 2 && First >= 0 && Second >= 0){
+            _BigramCounts[First * STATS_LETTERS + Second] += Count;
+        }
+    }
+    return true;
+}
+
+bool TypingStats::Save(void){
+    // The bigrams by decreasing count, as in count_2l.txt
+    QVector<int> Bigrams;
+    for(int Bigram = 0; Bigram < STATS_LETTERS * STATS_LETTERS; Bigram++){
+        if(_BigramCounts[Bigram] != 0){
+            Bigrams.append(Bigram);
+        }
+    }
+    std::stable_sort(Bigrams.begin(), Bigrams.end(),
+                     [this](const int A, const int B){ return _BigramCounts[A] > _BigramCounts[B]; });
+
+    // Written to a temporary file renamed over the previous one: a crash never leaves a truncated file
+    QSaveFile File(_Path);
+    if(!File.open(QIODevice::WriteOnly | QIODevice::Text)){
+        qWarning() << "Cannot write the typing statistics" << _Path;
+        return false;
+    }
+    QTextStream Out(&File);
+    for(int Letter = 0; Letter < STATS_LETTERS; Letter++){
+        if(_LetterCounts[Letter] != 0){
+            Out << QChar('a' + Letter) << '\t' << _LetterCounts[Letter] << '\n';
+        }
+    }
+    for(const int Bigram : Bigrams){
+        Out << QChar('a' + Bigram / STATS_LETTERS) << QChar('a' + Bigram % STATS_LETTERS) << '\t' << _BigramCounts[Bigram] << '\n';
+    }
+    Out.flush();
+    if(!File.commit()){
+        qWarning() << "Cannot write the typing statistics" << _Path;
+        return false;
+    }
+    _Dirty = false;
+    return true;
+}
+
+quint64 TypingStats::Letters(void) const{
+    quint64 Total = 0;
+    for(const quint64 Count : _LetterCounts){
+        Total += Count;
+    }
+    return Total;
+}
+
+void TypingStats::RecordText(const QObject *Source, const QString &Text){
+    int &Previous = _Previous.insert(Source, _Previous.value(Source, -1)).value();
+    for(const QChar Character : Text){
+        const int Letter = StatsLetter(Character);
+        if(Letter < 0){ // A space, a punctuation or an emote ends the word
+            Previous = -1;
+            continue;
+        }
+        _LetterCounts[Letter]++;
+        if(Previous >= 0){
+            _BigramCounts[Previous * STATS_LETTERS + Letter]++;
+        }
+        Previous = Letter;
+        _Dirty = true;
+    }
+}
+
+void TypingStats::RecordKey(const QObject *Source, const Qt::Key Key){
+    Q_UNUSED(Key);
+    _Previous.remove(Source);
+}
@@ -0,0 +1,57 @@
+#include "Headers/WheelDelta.h"
+
+WheelDelta::WheelDelta()
+{
+    Clear();
+}
+
+void WheelDelta::SelectOuterTile(const uint8_t Tile){
+    Fields |= DELTA_OUTER_SELECTED;
+    OuterSelectedTile = Tile;
+}
+
+void WheelDelta::ResetInnerTiles(void){
+    Fields |= DELTA_INNER_RESET;
+    SelectInnerTile(DEFAULT_TILE);
+}
+
+void WheelDelta::SelectInnerTile(const uint8_t Tile){
+    Fields |= DELTA_INNER_SELECTED;
+    InnerSelectedTile = Tile;
+}
+
+void WheelDelta::SetOuterTexts(const ShiftState_t Shift){
+    Fields |= DELTA_OUTER_TEXTS;
+    OuterShift = Shift;
+}
+
+void WheelDelta::SetInnerTexts(const ShiftState_t Shift, const uint8_t Group){
+    Fields |= DELTA_INNER_TEXTS;
+    InnerShift = Shift;
+    CharGroup = Group;
+}
+
+void WheelDelta::SetSuggestion(const uint8_t Tile, const QString &Suggestion){
+    Fields |= DELTA_SUGGESTIONS;
+    for(QPair<uint8_t, QString> &Changed : Suggestions){
+        if(Changed.first == Tile){
+            Changed.second = Suggestion;
+            return;
+        }
+    }
+    Suggestions.append({Tile, Suggestion});
+}
+
+bool WheelDelta::IsEmpty(void) const{
+    return Fields == DELTA_NOTHING;
+}
+
+void WheelDelta::Clear(void){
+    Fields = DELTA_NOTHING;
+    OuterSelectedTile = DEFAULT_TILE;
+    InnerSelectedTile = DEFAULT_TILE;
+    OuterShift = NOT_SHIFTED;
+    InnerShift = NOT_SHIFTED;
+    CharGroup = 0;
+    Suggestions.clear();
+}
@@ -0,0 +1,104 @@
+#include "Headers/WheelViewModel.h"
+#include "Headers/KeyboardLayout.h"
+
+WheelViewModel::WheelViewModel()
+    : _SelectedTiles({DEFAULT_TILE, DEFAULT_TILE})
+    , _OuterShift(NOT_SHIFTED)
+    , _OuterTextsStale(false)
+    , _InnerTexts(NUMBER_OF_TILES, "")
+    , _InnerAvailable(NUMBER_OF_TILES, true)
+    , _Stats({0, 0, 0, 0})
+{
+    const CharGroup_t &CharsToDisplay = KeyboardLayout::Active().InnerChars(NOT_SHIFTED, 0);
+    for(uint8_t Index = 0; Index < CharsToDisplay.length(); Index++){
+        _InnerTexts[Index] = CharsToDisplay[Index];
+    }
+}
+
+WheelDelta WheelViewModel::Diff(const WheelDelta &Requested){
+    WheelDelta Changes;
+    quint64 RequestedFields = 0;
+    _Stats.RequestedDeltas++;
+
+    if(Requested.Fields & DELTA_OUTER_SELECTED){
+        RequestedFields++;
+        if(Requested.OuterSelectedTile != _SelectedTiles[OUTER]){
+            _SelectedTiles[OUTER] = Requested.OuterSelectedTile;
+            Changes.SelectOuterTile(Requested.OuterSelectedTile);
+        }
+    }
+
+    if(Requested.Fields & DELTA_INNER_RESET){
+        RequestedFields++;
+        if(_InnerAvailable.contains(false)){
+            _InnerAvailable.fill(true);
+            Changes.Fields |= DELTA_INNER_RESET; // Not ResetInnerTiles: the selection is diffed below
+        }
+    }
+
+    if(Requested.Fields & DELTA_INNER_SELECTED){
+        RequestedFields++;
+        if(Requested.InnerSelectedTile != _SelectedTiles[INNER]){
+            _SelectedTiles[INNER] = Requested.InnerSelectedTile;
+            Changes.SelectInnerTile(Requested.InnerSelectedTile);
+        }
+    }
+
+    if(Requested.Fields & DELTA_OUTER_TEXTS){
+        RequestedFields++;
+        if(Requested.OuterShift != _OuterShift || _OuterTextsStale){
+            _OuterShift = Requested.OuterShift;
+            _OuterTextsStale = false;
+            Changes.SetOuterTexts(Requested.OuterShift);
+        }
+    }
+
+    if(Requested.Fields & DELTA_INNER_TEXTS){
+        RequestedFields++;
+        // Compared tile by tile: a char group may overwrite the suggestions of the previous one
+        const CharGroup_t &Chars = KeyboardLayout::Active().InnerChars(Requested.InnerShift, Requested.CharGroup);
+        bool IsChanged = false;
+        for(uint8_t Index = 0; Index < Chars.length(); Index++){
+            if(_InnerTexts[Index] != Chars[Index]){
+                _InnerTexts[Index] = Chars[Index];
+                IsChanged = true;
+            }
+        }
+        if(IsChanged){
+            Changes.SetInnerTexts(Requested.InnerShift, Requested.CharGroup);
+        }
+    }
+
+    for(const QPair<uint8_t, QString> &Suggestion : Requested.Suggestions){
+        RequestedFields++;
+        const uint8_t Tile = Suggestion.first;
+        const bool IsAvailable = (Suggestion.second != "");
+        if(_InnerTexts[Tile] != Suggestion.second || _InnerAvailable[Tile] != IsAvailable){
+            _InnerTexts[Tile] = Suggestion.second;
+            _InnerAvailable[Tile] = IsAvailable;
+            Changes.SetSuggestion(Tile, Suggestion.second);
+        }
+    }
+
+    quint64 PublishedFields = Changes.Suggestions.size();
+    for(const WheelDeltaField_t Field : {DELTA_OUTER_SELECTED, DELTA_INNER_RESET, DELTA_INNER_SELECTED, DELTA_OUTER_TEXTS, DELTA_INNER_TEXTS}){
+        if(Changes.Fields & Field){
+            PublishedFields++;
+        }
+    }
+    _Stats.PublishedFields += PublishedFields;
+    _Stats.SuppressedFields += RequestedFields - PublishedFields;
+    if(!Changes.IsEmpty()){
+        _Stats.PublishedDeltas++;
+    }
+    return Changes;
+}
+
+void WheelViewModel::InvalidateTexts(void){
+    _OuterTextsStale = true;
+    _InnerTexts.fill(""); // No char is empty: every tile differs from the texts of the new layout
+}
+
+ViewModelStats_t WheelViewModel::GetStats(void) const{
+    return _Stats;
+}
@@ -0,0 +1,142 @@
+#include <QPainter>
+
+#include "Headers/WheelWidget.h"
+#include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/Trace.h"
+
+WheelWidget::WheelWidget(QWidget *parent)
+    : QWidget{parent}
+    , _Tiles(2, QVector<WheelTile_t>(NUMBER_OF_TILES, {"", true}))
+    , _SelectedTiles({DEFAULT_TILE, DEFAULT_TILE})
+    , _Stats({0, 0})
+{
+    const KeyboardLayout &Layout = KeyboardLayout::Active();
+    const CharGroup_t &CharsToDisplay = Layout.InnerChars(NOT_SHIFTED, 0);
+    for(uint8_t Index = 0; Index < NUMBER_OF_TILES; Index++){
+        _Tiles[INNER][Index].Text = (Index < CharsToDisplay.length()) ? CharsToDisplay[Index] : "";
+        _Tiles[OUTER][Index].Text = Layout.OuterTexts(NOT_SHIFTED)[Index];
+    }
+
+    QFont font;
+    font.setFamily(GLOBAL_FONT);
+    font.setPointSize(GuiScale::FontSize());
+    font.setWeight(QFont::ExtraBold);
+    setFont(font);
+}
+
+void WheelWidget::SetGeometryOnGrid(const placement_t WidgetPlacement)
+{
+    const QRect Geometry = GuiScale::ToPixels(WidgetPlacement);
+    QWidget::setGeometry(Geometry);
+
+    _InnerOrigin = GuiScale::ToPixels(Placements["InnerTileGroup"]).topLeft() - Geometry.topLeft();
+}
+
+QRect WheelWidget::TileRect(const radius_t Radius, const uint8_t Index) const{
+    const QPoint Origin = (Radius == INNER) ? _InnerOrigin : QPoint(0, 0);
+    return GuiScale::ToPixels(TileGroupsPlacements[Radius][Index]).translated(Origin);
+}
+
+TileState_t WheelWidget::StateOf(const radius_t Radius, const uint8_t Index) const{
+    if(!_Tiles[Radius][Index].IsAvailable){
+        return TILE_UNAVAILABLE;
+    }
+    return (_SelectedTiles[Radius] == Index) ? TILE_SELECTED : TILE_NORMAL;
+}
+
+void WheelWidget::paintEvent(QPaintEvent *Event){
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "WheelWidget::paintEvent");
+    _Stats.Repaints++;
+    QPainter Painter(this);
+    const QRegion Dirty = Event->region();
+    for(const radius_t Radius : {OUTER, INNER}){ // The inner group is above the outer one
+        for(uint8_t Index = 0; Index < NUMBER_OF_TILES; Index++){
+            const QRect Rect = TileRect(Radius, Index);
+            if(!Dirty.intersects(Rect)){
+                continue;
+            }
+            Painter.drawPixmap(Rect, TileBackgroundCache::Get(Radius, Index, StateOf(Radius, Index)));
+            Painter.drawText(Rect, Qt::AlignCenter, _Tiles[Radius][Index].Text);
+        }
+    }
+}
+
+WheelStats_t WheelWidget::GetStats(void) const{
+    return _Stats;
+}
+
+void WheelWidget::Invalidate(const QRect &Rect){
+    _Dirty += Rect;
+}
+
+void WheelWidget::ApplyDelta(const WheelDelta &Delta){
+    GP4K_TRACE_SPAN(TRACE_DETAIL, "WheelWidget::ApplyDelta");
+    _Stats.SlotCalls++;
+    if(Delta.Fields & DELTA_OUTER_SELECTED){
+        SetSelected(OUTER, Delta.OuterSelectedTile);
+    }
+    if(Delta.Fields & DELTA_INNER_RESET){
+        SetAllAvailable();
+    }
+    if(Delta.Fields & DELTA_INNER_SELECTED){
+        SetSelected(INNER, Delta.InnerSelectedTile);
+    }
+    if(Delta.Fields & DELTA_OUTER_TEXTS){
+        SetTexts(OUTER, KeyboardLayout::Active().OuterTexts(Delta.OuterShift));
+    }
+    if(Delta.Fields & DELTA_INNER_TEXTS){
+        SetTexts(INNER, KeyboardLayout::Active().InnerChars(Delta.InnerShift, Delta.CharGroup));
+    }
+    for(const QPair<uint8_t, QString> &Changed : Delta.Suggestions){
+        SetText(INNER, Changed.first, Changed.second);
+        SetAvailability(Changed.first, Changed.second != "");
+    }
+
+    if(!_Dirty.isEmpty()){
+        update(_Dirty);
+        _Dirty = QRegion();
+    }
+}
+
+void WheelWidget::SetText(const radius_t Radius, const uint8_t Index, const QString &Text){
+    if(_Tiles[Radius][Index].Text != Text){
+        _Tiles[Radius][Index].Text = Text;
+        Invalidate(TileRect(Radius, Index));
+    }
+}
+
+void WheelWidget::SetTexts(const radius_t Radius, const CharGroup_t &Texts){
+    // Only the char tiles of the inner group: the suggestion tiles are written from the delta's suggestions
+    for(uint8_t TileIndex = 0; TileIndex < Texts.length(); TileIndex++){
+        SetText(Radius, TileIndex, Texts[TileIndex]);
+    }
+}
+
+void WheelWidget::SetSelected(const radius_t Radius, const uint8_t TileIndex){
+    const uint8_t PreviousTile = _SelectedTiles[Radius];
+    if(PreviousTile == TileIndex){
+        return;
+    }
+    _SelectedTiles[Radius] = TileIndex;
+    if(PreviousTile != DEFAULT_TILE){
+        Invalidate(TileRect(Radius, PreviousTile));
+    }
+    if(TileIndex != DEFAULT_TILE){
+        Invalidate(TileRect(Radius, TileIndex));
+    }
+}
+
+void WheelWidget::SetAvailability(const uint8_t TileIndex, const bool IsAvailable){
+    if(_Tiles[INNER][TileIndex].IsAvailable != IsAvailable){
+        _Tiles[INNER][TileIndex].IsAvailable = IsAvailable;
+        Invalidate(TileRect(INNER, TileIndex));
+    }
+}
+
+void WheelWidget::SetAllAvailable(void){
+    for(uint8_t TileIndex = 0; TileIndex < NUMBER_OF_TILES; TileIndex++){
+        SetAvailability(TileIndex, true);
+    }
+}
@@ -1,16 +1,197 @@
 #include "Headers/mainwindow.h"
+#include "Headers/GamepadInput.h"
+#include "Headers/GuiScale.h"
+#include "Headers/InputRecorder.h"
+#include "Headers/InputReplayer.h"
+#include "Headers/KeyboardLayout.h"
+#include "Headers/LayoutWatcher.h"
+#include "Headers/TypingStats.h"
+#include "Headers/StartupProbe.h"
+#include "Headers/Trace.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QLabel>
 
+/**
+ * @brief Prints the transitions the stick state machines suppressed, the suggestions prefetching efficiency and the
+ * work of the wheel per event.
+ * @param Session The window of the session.
+ */
+static void PrintSessionMetrics(const MainWindow &Session){
+    const Controller *GP4k_Controller = Session.GetController();
+    for(const stick_t Stick : {STICK_LEFT, STICK_RIGHT}){
+        const StickMetrics_t Metrics = GP4k_Controller->GetStickMetrics(Stick);
+        qInfo().nospace() << ((Stick == STICK_LEFT) ? "Left" : "Right") << " stick: "
+                          << Metrics.TileChanges << " tile changes (" << Metrics.SingleThresholdTileChanges << " with a single threshold), "
+                          << Metrics.Releases << " releases (" << Metrics.SingleThresholdReleases << " with a single threshold), "
+                          << Metrics.DwellRejections << " dwell rejections";
+    }
+    qInfo() << "Signals saved by the stick state machines:" << GP4k_Controller->GetSuppressedEmissions();
+
+    const PrefetchStats_t Prefetch = GP4k_Controller->GetPrefetchStats();
+    const quint64 Queries = Prefetch.Hits + Prefetch.LateHits + Prefetch.Misses;
+    qInfo().nospace() << "Suggestions prefetching: " << Prefetch.Hits << " hits, " << Prefetch.LateHits << " late hits, "
+                      << Prefetch.Misses << " misses (hit rate " << ((Queries > 0) ? 100.0 * (Prefetch.Hits + Prefetch.LateHits) / Queries : 0.0)
+                      << " %), " << Prefetch.Wasted << " of " << Prefetch.Launched << " prefetched lists wasted, "
+                      << ((Queries > 0) ? Prefetch.SeekTime / static_cast<qint64>(Queries) : 0) << " ns per query, "
+                      << Prefetch.Deferred << " queries deferred until the dictionary was loaded";
+
+    const SwipeStats_t Swipe = GP4k_Controller->GetSwipeStats();
+    if(Swipe.Swipes > 0){
+        qInfo().nospace() << "Swipes: " << Swipe.Words << " words typed out of " << Swipe.Swipes << " swipes, "
+                          << static_cast<double>(Swipe.Keys) / Swipe.Swipes << " tiles visited per swipe, decoding mean "
+                          << Swipe.DecodeTime / static_cast<qint64>(Swipe.Swipes) << " ns, max " << Swipe.MaxDecodeTime << " ns";
+    }
+
+    const ViewModelStats_t ViewModel = GP4k_Controller->GetViewModelStats();
+    const quint64 RequestedFields = ViewModel.PublishedFields + ViewModel.SuppressedFields;
+    qInfo().nospace() << "View model: " << ViewModel.SuppressedFields << " of " << RequestedFields << " wheel updates suppressed ("
+                      << ((RequestedFields > 0) ? 100.0 * ViewModel.SuppressedFields / RequestedFields : 0.0) << " %), "
+                      << ViewModel.RequestedDeltas - ViewModel.PublishedDeltas << " of " << ViewModel.RequestedDeltas
+                      << " emissions suppressed";
+
+    const quint64 Inputs = GP4k_Controller->GetHandledInputs();
+    const WheelStats_t Wheel = Session.GetWheel()->GetStats();
+    qInfo().nospace() << "Wheel: " << Wheel.SlotCalls << " slot calls and " << Wheel.Repaints << " repaints for "
+                      << Inputs << " events (" << ((Inputs > 0) ? static_cast<double>(Wheel.SlotCalls) / Inputs : 0.0)
+                      << " slot calls and " << ((Inputs > 0) ? static_cast<double>(Wheel.Repaints) / Inputs : 0.0)
+                      << " repaints per event)";
+}
+
 int main(int argc, char *argv[])
 {
+    QElapsedTimer StartupClock;
+    StartupClock.start();
+
     QApplication a(argc, argv); // Creating the application...
 
-    MainWindow w; // Creating the window...
+    QCommandLineParser Parser;
+    Parser.addHelpOption();
+    const QCommandLineOption RecordOption("record", "Record the gamepad events in <file>, saved when quitting.", "file");
+    const QCommandLineOption ReplayOption("replay", "Replay the gamepad events of <file>, then quit.", "file");
+    const QCommandLineOption FastOption("fast", "Replay the events as fast as possible instead of in real time.");
+    const QCommandLineOption MultiSessionOption("multi-session", "Open an independent typing session for each allowed gamepad.");
+    const QCommandLineOption StartupProbeOption("startup-probe", "Print the time to first frame and to first suggestion, then quit.");
+    const QCommandLineOption ScaleOption("scale", "Draw the GUI at <factor> times its default size, instead of the one fitting the screen.", "factor");
+    const QCommandLineOption PlainTextOption("plain-text", "Use the plain text field, faster on long documents.");
+    const QCommandLineOption TraceOption("trace", "Write the recorded trace in <file> when quitting, in the Chrome trace format.", "file");
+    const QCommandLineOption LayoutOption("layout", "Use the layout of <file>, text or compiled, reloaded each time it changes.", "file");
+    const QCommandLineOption StatsOption("stats", "Count the letters and bigrams typed in <file>, for gp4k-layout-optimizer --personal. "
+                                         "The text itself is never stored.", "file");
+    Parser.addOptions({RecordOption, ReplayOption, FastOption, MultiSessionOption, StartupProbeOption, ScaleOption, PlainTextOption, TraceOption, LayoutOption, StatsOption});
+    Parser.process(a);
+
+    // Before any widget. Without --scale, the value is 0: the scale fitting the screen
+    GuiScale::Initialize(Parser.value(ScaleOption).toDouble());
+
+    // Before any widget too: they display the texts of the active layout
+    if(Parser.isSet(LayoutOption)){
+        KeyboardLayout Layout;
+        QStringList Errors;
+        if(!KeyboardLayout::Load(Parser.value(LayoutOption), Layout, Errors)){
+            qCritical().noquote().nospace() << "Invalid layout " << Parser.value(LayoutOption) << ":\n    " << Errors.join("\n    ");
+            return 2;
+        }
+        KeyboardLayout::SetActive(Layout);
+    }
+
+    const QList<int> AllowedList = Parser.isSet(MultiSessionOption) ? GamepadInput::AllowedGamepads() : QList<int>();
+    const TextFieldMode_t TextFieldMode = Parser.isSet(PlainTextOption) ? TEXT_FIELD_PLAIN : TEXT_FIELD_RICH;
+    MainWindow w(AllowedList.isEmpty() ? -1 : AllowedList.first(), TextFieldMode); // Creating the window...
+
+    /* The other gamepads get their own window. The sessions only share
+     * the dictionary, see Trie::Shared, and are recorded or replayed
+     * through the first window only. */
+    QVector<MainWindow*> OtherSessions;
+    for(int Index = 1; Index < AllowedList.size(); Index++){
+        OtherSessions.append(new MainWindow(AllowedList[Index], TextFieldMode));
+    }
+
+    if(Parser.isSet(LayoutOption)){
+        LayoutWatcher *Watcher = new LayoutWatcher(Parser.value(LayoutOption), &a);
+        QObject::connect(Watcher, &LayoutWatcher::LayoutChanged, w.GetController(), &Controller::ReloadLayout);
+        for(MainWindow* Session : OtherSessions){
+            QObject::connect(Watcher, &LayoutWatcher::LayoutChanged, Session->GetController(), &Controller::ReloadLayout);
+        }
+    }
+
+    if(Parser.isSet(StatsOption)){ // Saved periodically, then when the application is destroyed
+        TypingStats *Stats = new TypingStats(Parser.value(StatsOption), &a);
+        for(MainWindow* Session : QVector<MainWindow*>({&w}) + OtherSessions){
+            const Controller *Source = Session->GetController();
+            QObject::connect(Source, &Controller::CharTyped, Stats, [Stats, Source](const QString &Text){
+                Stats->RecordText(Source, Text);
+            });
+            QObject::connect(Source, &Controller::SendOrderToTextField, Stats, [Stats, Source](const Qt::Key Key){
+                Stats->RecordKey(Source, Key);
+            });
+        }
+    }
+
+    if(Parser.isSet(TraceOption)){
+        if(GP4K_TRACE_LEVEL == TRACE_OFF){
+            qWarning() << "Tracing is not compiled in: rebuild with qmake \"GP4K_TRACE_LEVEL=2\" to record events.";
+        }
+        QObject::connect(&a, &QApplication::aboutToQuit, [&Parser, &TraceOption](){
+            const QString TracePath = Parser.value(TraceOption);
+            if(Trace::ExportChromeJson(TracePath)){
+                qInfo() << "Trace written in" << TracePath;
+            }else{
+                qWarning() << "Cannot write the trace in" << TracePath;
+            }
+        });
+    }
+
+    InputRecorder Recorder;
+    if(Parser.isSet(RecordOption)){
+        w.GetController()->SetRecorder(&Recorder);
+        QObject::connect(&a, &QApplication::aboutToQuit, [&](){
+            const QString LogPath = Parser.value(RecordOption);
+            if(Recorder.Save(LogPath, w.GetTypedText())){
+                qInfo() << Recorder.GetEventsCount() << "events recorded in" << LogPath;
+            }
+            PrintSessionMetrics(w);
+        });
+    }
+
+    InputReplayer Replayer(w.GetController());
+    if(Parser.isSet(ReplayOption)){
+        InputLog_t Log;
+        if(!InputRecorder::Load(Parser.value(ReplayOption), Log)){
+            return 2;
+        }
+        QObject::connect(&Replayer, &InputReplayer::Finished, [&](){
+            const ReplayReport_t Report = Replayer.GetReport(w.GetTypedText());
+            const double Seconds = Report.WallTime / 1e9;
+            qInfo().nospace() << "Replayed " << Report.EventsCount << " events in " << Seconds << " s ("
+                              << ((Seconds > 0) ? Report.EventsCount / Seconds : 0) << " events/s)";
+            qInfo().nospace() << "Handling latency: mean " << ((Report.EventsCount > 0) ? Report.HandlingTime / Report.EventsCount : 0)
+                              << " ns, max " << Report.MaxLatency << " ns";
+            PrintSessionMetrics(w);
+            qInfo() << (Report.TextMatches ? "Text matches the recording." : "Text DIFFERS from the recording!");
+            a.exit(Report.TextMatches ? 0 : 1);
+        });
+        // The recorded text may use suggestions: the replay waits for the dictionary
+        const ReplayMode_t Mode = Parser.isSet(FastOption) ? REPLAY_FAST : REPLAY_REAL_TIME;
+        QObject::connect(w.GetController(), &Controller::DictionaryReady, &Replayer, [&Replayer, Log, Mode](){
+            Replayer.Start(Log, Mode);
+        });
+    }
+
+    if(Parser.isSet(StartupProbeOption)){
+        StartupProbe* Probe = new StartupProbe(StartupClock, &w, w.GetController(), &a);
+        QObject::connect(Probe, &StartupProbe::Finished, &a, &QApplication::quit);
+    }
 
     w.show(); // Showing the window...
+    for(MainWindow* Session : OtherSessions){
+        Session->show();
+    }
 
-    return a.exec();
+    const int ExitCode = a.exec();
+    qDeleteAll(OtherSessions);
+    return ExitCode;
 }
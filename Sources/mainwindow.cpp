@@ -1,12 +1,14 @@
 #include "Headers/mainwindow.h"
 #include "Headers/Controller.h"
+#include "Headers/GamepadInput.h"
 #include "Headers/GP4k_Typedefs.h"
 #include "Headers/GuideWidget.h"
 
-#include "Headers/TileGroupWidget.h"
+#include "Headers/WheelWidget.h"
 #include "Headers/TextFieldWidget.h"
 #include "Headers/ImageWidget.h"
 #include "Headers/GP4k_GuiMapping.h"
+#include "Headers/GuiScale.h"
 #include "Headers/GP4k_ButtonsMapping.h"
 
 #include <QFrame>
@@ -16,20 +18,31 @@
 #include <QString>
 #include <QDebug>
 
-MainWindow::MainWindow(QWidget *parent)
+MainWindow::MainWindow(const int GamepadId, const TextFieldMode_t TextFieldMode, QWidget *parent)
     : QMainWindow(parent)
+    , _Controller(nullptr)
+    , _TextField(nullptr)
+    , _PlainTextField(nullptr)
+    , _Wheel(nullptr)
+    , _DpadCenter(nullptr)
 {
-    setMinimumSize(WINDOW_SIZE_X, WINDOW_SIZE_Y);
-    setMaximumSize(WINDOW_SIZE_X, WINDOW_SIZE_Y);
+    setMinimumSize(GuiScale::WindowSize());
+    setMaximumSize(GuiScale::WindowSize());
 
+    if(GamepadId != -1){ // Several windows: tells the players which one is theirs
+        setWindowTitle(QString("GP4k - Gamepad %1").arg(GamepadId));
+    }
+
+    GamepadInput* Gamepad = new GamepadInput(GamepadId, this);
     Controller* GP4k_Controller = new Controller(this);
-    const brand_t ControllerBrand = GP4k_Controller->GetBrand();
+    GP4k_Controller->AddInputSource(Gamepad);
+    _Controller = GP4k_Controller;
+    const brand_t ControllerBrand = Gamepad->GetBrand();
 
     ImageWidget* Sticks = new ImageWidget(":/Resources/Icons/Sticks.svg", this);
-    TileGroupWidget* OuterTileGroup = new OuterTileGroupWidget(this);
-    InnerTileGroupWidget* InnerTileGroup = new InnerTileGroupWidget(this);
-    QTextEditCustom* TextField = new QTextEditCustom(this);
-    QVector<GuideWidget*> ButtonsGuides = {
+    WheelWidget* Wheel = new WheelWidget(this);
+    _Wheel = Wheel;
+    _ButtonsGuides = {
         new GuideWidget(&Button_Y, ControllerBrand, this),
         new GuideWidget(&Button_X, ControllerBrand, this),
         new GuideWidget(&Button_LB, ControllerBrand, this),
@@ -41,34 +54,36 @@ MainWindow::MainWindow(QWidget *parent)
         new GuideWidget(&Dpad_RIGHT, ControllerBrand, this)
     };
 
-    InnerTileGroup->SetGeometryOnGrid(Placements["InnerTileGroup"]);
-    OuterTileGroup->SetGeometryOnGrid(Placements["OuterTileGroup"]);
-    TextField->SetGeometryOnGrid(Placements["TextField"]);
+    Wheel->SetGeometryOnGrid(Placements["OuterTileGroup"]);
     Sticks->SetGeometryOnGrid(Placements["Sticks"]);
-    for (auto& Guide : ButtonsGuides){
+    for (auto& Guide : _ButtonsGuides){
         Guide->SetGeometryOnGrid(Placements[Guide->GetIconName()]);
     }
 
-    if(ControllerBrand == XBOX){
-        ImageWidget* DpadCenter = new ImageWidget(":/Resources/Icons/Xbox/center.svg", this);
-        DpadCenter->SetGeometryOnGrid(Placements["DpadCenter"]);
-    }else if(ControllerBrand == PLAYSTATION){
-        ImageWidget* DpadCenter = new ImageWidget(":/Resources/Icons/Playstation/center.svg", this);
-        DpadCenter->SetGeometryOnGrid(Placements["DpadCenter"]);
-    }
+    _DpadCenter = new ImageWidget(":/Resources/Icons/Xbox/center.svg", this);
+    _DpadCenter->SetGeometryOnGrid(Placements["DpadCenter"]);
+    SetBrand(ControllerBrand);
+    // The pad can be replaced by one of another brand after the startup
+    connect(Gamepad, &GamepadInput::BrandChanged, this, &MainWindow::SetBrand);
 
-    connect(GP4k_Controller, &Controller::TypeToTextField, TextField, &QTextEditCustom::insertPlainText);
-    connect(GP4k_Controller, &Controller::SendOrderToTextField, TextField, &QTextEditCustom::OrderReceived);
-    for (auto& Guide : ButtonsGuides){
+    if(TextFieldMode == TEXT_FIELD_PLAIN){
+        PlainTextFieldWidget* TextField = new PlainTextFieldWidget(this);
+        _PlainTextField = TextField;
+        TextField->SetGeometryOnGrid(Placements["TextField"]);
+        connect(GP4k_Controller, &Controller::TypeToTextField, TextField, &PlainTextFieldWidget::InsertText);
+        connect(GP4k_Controller, &Controller::SendOrderToTextField, TextField, &PlainTextFieldWidget::OrderReceived);
+        connect(GP4k_Controller, &Controller::TextEditsEnded, TextField, &PlainTextFieldWidget::EndEditBlock);
+    }else{
+        QTextEditCustom* TextField = new QTextEditCustom(this);
+        _TextField = TextField;
+        TextField->SetGeometryOnGrid(Placements["TextField"]);
+        connect(GP4k_Controller, &Controller::TypeToTextField, TextField, &QTextEditCustom::insertPlainText);
+        connect(GP4k_Controller, &Controller::SendOrderToTextField, TextField, &QTextEditCustom::OrderReceived);
+    }
+    for (auto& Guide : _ButtonsGuides){
         connect(GP4k_Controller, &Controller::ToggleTextsOnShift, Guide, &GuideWidget::SetGuideText);
     }
-    connect(GP4k_Controller, &Controller::ToggleTextsOnShift, OuterTileGroup, &TileGroupWidget::SetTileText);
-    connect(GP4k_Controller, &Controller::ToggleOuterSelectedTile, OuterTileGroup, &TileGroupWidget::SetTileSelected);
-    connect(GP4k_Controller, &Controller::ToggleInnerSelectedTile, InnerTileGroup, &InnerTileGroupWidget::SetTileSelected);
-    connect(GP4k_Controller, &Controller::ResetCenterBackgrounds, InnerTileGroup, &InnerTileGroupWidget::ResetTiles);
-    connect(GP4k_Controller, &Controller::ToggleTextsOnShift, InnerTileGroup, &InnerTileGroupWidget::SetTileText);
-    connect(GP4k_Controller, &Controller::UpdateInnerTiles, InnerTileGroup, &InnerTileGroupWidget::SetTileText);
-    connect(GP4k_Controller, &Controller::UpdateSuggestionTile, InnerTileGroup, &InnerTileGroupWidget::SetSuggestionTile);
+    connect(GP4k_Controller, &Controller::UpdateWheel, Wheel, &WheelWidget::ApplyDelta);
 
     GP4k_Controller->InitializeTilesContent();
 }
@@ -78,4 +93,32 @@ MainWindow::~MainWindow()
 
 }
 
+Controller* MainWindow::GetController(void) const{
+    return _Controller;
+}
+
+WheelWidget* MainWindow::GetWheel(void) const{
+    return _Wheel;
+}
+
+void MainWindow::SetBrand(const brand_t Brand){
+    for (auto& Guide : _ButtonsGuides){
+        Guide->SetBrand(Brand);
+    }
+
+    if(Brand == XBOX){
+        _DpadCenter->SetImage(":/Resources/Icons/Xbox/center.svg");
+        _DpadCenter->show();
+    }else if(Brand == PLAYSTATION){
+        _DpadCenter->SetImage(":/Resources/Icons/Playstation/center.svg");
+        _DpadCenter->show();
+    }else{
+        _DpadCenter->hide();
+    }
+}
+
+QString MainWindow::GetTypedText(void) const{
+    return (_PlainTextField != nullptr) ? _PlainTextField->toPlainText() : _TextField->toPlainText();
+}
+
 
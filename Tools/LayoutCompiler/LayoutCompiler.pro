@@ -0,0 +1,15 @@
+# Layout compiler: validates a layout text file and compiles it into the
+# binary format the application loads with --layout.
+
+QT -= gui
+QT += core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-layoutc
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    main.cpp
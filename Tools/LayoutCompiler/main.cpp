@@ -0,0 +1,82 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+
+#include "Headers/KeyboardLayout.h"
+
+/**
+ * @brief Writes a file at once.
+ * @param Path The file to write.
+ * @param Data The content of the file.
+ * @return False if the file can't be written.
+ */
+static bool WriteFile(const QString &Path, const QByteArray &Data){
+    QFile File(Path);
+    if(!File.open(QIODevice::WriteOnly | QIODevice::Truncate) || File.write(Data) != Data.size()){
+        qCritical() << "Cannot write" << Path;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Validates a GP4k layout file and compiles it, or decompiles it back to text.");
+    Parser.addHelpOption();
+    Parser.addPositionalArgument("layout", "The layout to read, text or compiled. Omitted with --builtin.");
+    const QCommandLineOption OutputOption({"o", "output"}, "Write the compiled layout in <file>.", "file");
+    const QCommandLineOption TextOption("text", "Write the layout as text in <file> instead, - for the standard output.", "file");
+    const QCommandLineOption BuiltinOption("builtin", "Read the built-in layout of GP4k_TilesMapping.h and GP4k_ButtonsMapping.h.");
+    Parser.addOptions({OutputOption, TextOption, BuiltinOption});
+    Parser.process(a);
+
+    if(Parser.positionalArguments().length() != (Parser.isSet(BuiltinOption) ? 0 : 1)){
+        Parser.showHelp(2);
+    }
+
+    KeyboardLayout Layout = KeyboardLayout::Builtin();
+    const QString Source = Parser.isSet(BuiltinOption) ? QString("built-in") : Parser.positionalArguments()[0];
+    if(!Parser.isSet(BuiltinOption)){
+        QStringList Errors;
+        if(!KeyboardLayout::Load(Source, Layout, Errors)){
+            QTextStream Err(stderr);
+            for(const QString &Error : Errors){
+                Err << Source << ": " << Error << "\n";
+            }
+            return 1;
+        }
+    }
+
+    const QByteArray Compiled = Layout.ToBinary();
+    if(Parser.isSet(OutputOption) && !WriteFile(Parser.value(OutputOption), Compiled)){
+        return 2;
+    }
+    if(Parser.isSet(TextOption)){
+        if(Parser.value(TextOption) == "-"){
+            QTextStream(stdout) << Layout.ToText();
+            return 0;
+        }
+        if(!WriteFile(Parser.value(TextOption), Layout.ToText().toUtf8())){
+            return 2;
+        }
+    }
+
+    int Chars = 0;
+    for(int Group = 0; Group < Layout.GroupsCount(); Group++){
+        Chars += Layout.InnerChars(NOT_SHIFTED, Group).length();
+    }
+    QTextStream Out(stdout);
+    Out << "layout: " << Source << "\n"
+        << "valid: true\n"
+        << "groups: " << Layout.GroupsCount() << "\n"
+        << "char_tiles: " << Chars << "\n"
+        << "single_char_lookups: " << Layout.Chars().Size() << "\n"
+        << "compiled_bytes: " << Compiled.size() << "\n";
+    return 0;
+}
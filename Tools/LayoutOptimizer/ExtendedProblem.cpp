@@ -0,0 +1,482 @@
+#include <algorithm>
+#include <cmath>
+
+#include <QFile>
+#include <QPair>
+#include <QStringList>
+
+#include "Headers/KeyboardLayout.h"
+#include "ExtendedProblem.h"
+
+/**
+ * @def TRIGRAM_CODES
+ * @brief The codes of the trigram counts: the characters, then the space.
+ */
+#define TRIGRAM_CODES (EXTENDED_CHARS + 1)
+
+/**
+ * @brief The buttons of the D-pad, in the order of their slots: slot N is NOT_SHIFTED if even, on button N / 2.
+ */
+static const QVector<const PhysicalButton_t*> DpadButtons = {&Dpad_UP, &Dpad_DOWN, &Dpad_LEFT, &Dpad_RIGHT};
+
+/**
+ * @brief The punctuation the extended problem places, by the name of their constant in GP4k_ButtonsMapping.h.
+ */
+static const QVector<QPair<QString, const feature_t*>> PunctuationNames = {
+    {"COMMA", &COMMA},
+    {"PERIOD", &PERIOD},
+    {"EXCLAM", &EXCLAM},
+    {"QUESTION", &QUESTION},
+    {"APOSTROPHE", &APOSTROPHE},
+    {"HYPHEN", &HYPHEN},
+    {"SEMI_COLON", &SEMI_COLON},
+    {"COLON", &COLON}
+};
+
+/**
+ * @brief The punctuation items, in the order of the shipped D-pad slots: the item LAYOUT_ALPHABET + N is on slot N.
+ * @return The features of the D-pad.
+ */
+static const QVector<feature_t> &DpadPunctuation(void){
+    static const QVector<feature_t> Features = [](){
+        QVector<feature_t> Shipped;
+        for(const PhysicalButton_t *Button : DpadButtons){
+            Shipped << Button->Features[NOT_SHIFTED] << Button->Features[SHIFTED];
+        }
+        return Shipped;
+    }();
+    return Features;
+}
+
+/**
+ * @brief The name of a punctuation, as read by KeyboardLayout::FromText.
+ * @param Feature The feature of the punctuation.
+ * @return The name of its constant in GP4k_ButtonsMapping.h.
+ */
+static QString PunctuationName(const feature_t &Feature){
+    for(const auto &Known : PunctuationNames){
+        if(*Known.second == Feature){
+            return Known.first;
+        }
+    }
+    return QString();
+}
+
+int ExtendedCode(const QChar Character){
+    static const QString Alphabet = LAYOUT_ALPHABET;
+    if(Character.isSpace()){
+        return static_cast<int>(EXTENDED_CHARS);
+    }
+    const QChar Lower = (Character == '\'') ? QChar(0x2019) : Character.toLower(); // The apostrophe of APOSTROPHE
+    const int Letter = Alphabet.indexOf(Lower);
+    if(Letter >= 0){
+        return Letter;
+    }
+    for(int Punctuation = 0; Punctuation < DpadPunctuation().length(); Punctuation++){
+        if(DpadPunctuation()[Punctuation].Text[1] == Lower){
+            return Alphabet.length() + Punctuation;
+        }
+    }
+    return -1;
+}
+
+bool LoadTrigramCounts(const QString &Path, std::vector<int64_t> &Counts){
+    QFile File(Path);
+    if(!File.open(QIODevice::ReadOnly | QIODevice::Text)){
+        return false;
+    }
+    QTextStream Stream(&File);
+    Stream.setCodec("UTF-8");
+
+    Counts.assign(TRIGRAM_CODES * TRIGRAM_CODES * TRIGRAM_CODES, 0);
+    QString Line;
+    while(Stream.readLineInto(&Line)){
+        const int Tab = Line.indexOf('\t');
+        if(Tab != 3){ // Not a trigram
+            continue;
+        }
+        const int First = ExtendedCode(Line[0]);
+        const int Second = ExtendedCode(Line[1]);
+        const int Third = ExtendedCode(Line[2]);
+        if(First >= 0 && Second >= 0 && Third >= 0){
+            Counts[(First * TRIGRAM_CODES + Second) * TRIGRAM_CODES + Third] += Line.midRef(Tab + 1).toLongLong();
+        }
+    }
+    return true;
+}
+
+void CountTrigrams(QTextStream &Corpus, const int MaxLines, std::vector<int64_t> &Counts){
+    Counts.assign(TRIGRAM_CODES * TRIGRAM_CODES * TRIGRAM_CODES, 0);
+    QString Line;
+    int First = -1;
+    int Second = -1;
+    for(int Lines = 0; (MaxLines <= 0 || Lines < MaxLines) && Corpus.readLineInto(&Line); Lines++){
+        Line += ' ';
+        for(const QChar Character : Line){
+            const int Third = ExtendedCode(Character);
+            if(First >= 0 && Second >= 0 && Third >= 0){
+                Counts[(First * TRIGRAM_CODES + Second) * TRIGRAM_CODES + Third]++;
+            }
+            First = Second;
+            Second = Third;
+        }
+    }
+}
+
+ExtendedProblem::ExtendedProblem(const std::vector<int64_t> &Counts, const int Groups, const ExtendedSettings_t &Settings)
+    : _Groups(Groups)
+    , _TilesPerGroup(Settings.TilesPerGroup)
+    , _Size(Groups * Settings.TilesPerGroup + EXTENDED_DPAD_SLOTS)
+    , _UnknownGroupCost(EXTENDED_COST_SCALE * (Groups - 1) / std::max(Groups, 1))
+    , _KeptMass(0.0)
+{
+    for(int Location = 0; Location < _Size; Location++){
+        const bool IsTile = Location < _Groups * _TilesPerGroup;
+        const int Slot = Location - _Groups * _TilesPerGroup;
+        _LocationGroups.push_back(IsTile ? Location / _TilesPerGroup : -1);
+        _LocationPresses.push_back((IsTile || Slot % 2 == NOT_SHIFTED) ? EXTENDED_COST_SCALE : 2 * EXTENDED_COST_SCALE);
+    }
+    _LocationGroups.push_back(-1); // The space, on a button
+    _LocationPresses.push_back(EXTENDED_COST_SCALE);
+
+    // The space keeps its code past the items: it's never moved
+    const auto Code = [this](const int CountCode){ return static_cast<uint8_t>((CountCode == static_cast<int>(EXTENDED_CHARS)) ? _Size : CountCode); };
+    _ItemCounts.assign(_Size, 0);
+    int64_t TotalMass = 0;
+    for(int First = 0; First < static_cast<int>(TRIGRAM_CODES); First++){
+        for(int Second = 0; Second < static_cast<int>(TRIGRAM_CODES); Second++){
+            for(int Third = 0; Third < static_cast<int>(TRIGRAM_CODES); Third++){
+                const int64_t Count = Counts[(First * TRIGRAM_CODES + Second) * TRIGRAM_CODES + Third];
+                // A space only costs something to place after a punctuation, whose D-pad slot types it
+                const bool IsPunctuationSpace = Third == static_cast<int>(EXTENDED_CHARS) && !IsLetter(Second)
+                                             && Second < static_cast<int>(EXTENDED_CHARS)
+                                             && DpadPunctuation()[Second - (sizeof(LAYOUT_ALPHABET) - 1)].FeatureType == PUNCTUATION;
+                if(Count <= 0 || (Third == static_cast<int>(EXTENDED_CHARS) && !IsPunctuationSpace)){
+                    continue;
+                }
+                if(Third < static_cast<int>(EXTENDED_CHARS)){
+                    _ItemCounts[Third] += Count;
+                }
+                _Trigrams.push_back({{Code(First), Code(Second), Code(Third)}, Count});
+                TotalMass += Count;
+            }
+        }
+    }
+    std::stable_sort(_Trigrams.begin(), _Trigrams.end(), [](const Trigram_t &A, const Trigram_t &B){ return A.Count > B.Count; });
+    if(static_cast<int>(_Trigrams.size()) > Settings.MaxTrigrams){
+        _Trigrams.resize(std::max(Settings.MaxTrigrams, 0));
+    }
+    int64_t KeptMass = 0;
+    for(const Trigram_t &Trigram : _Trigrams){
+        KeptMass += Trigram.Count;
+    }
+    _KeptMass = (TotalMass > 0) ? static_cast<double>(KeptMass) / TotalMass : 1.0;
+
+    // Each trigram is listed once per distinct item it holds
+    _ItemTrigramsStart.assign(_Size + 1, 0);
+    for(int Pass = 0; Pass < 2; Pass++){
+        std::vector<int> Next = _ItemTrigramsStart;
+        for(int Index = 0; Index < static_cast<int>(_Trigrams.size()); Index++){
+            const Trigram_t &Trigram = _Trigrams[Index];
+            for(int Position = 0; Position < 3; Position++){
+                const int Item = Trigram.Codes[Position];
+                const bool Repeated = (Position > 0 && Trigram.Codes[0] == Item) || (Position > 1 && Trigram.Codes[1] == Item);
+                if(Item >= _Size || Repeated){
+                    continue;
+                }
+                if(Pass == 0){
+                    _ItemTrigramsStart[Item + 1]++;
+                }else{
+                    _ItemTrigrams[Next[Item]++] = {{Trigram.Codes[0], Trigram.Codes[1], Trigram.Codes[2]}, Index, Trigram.Count};
+                }
+            }
+        }
+        if(Pass == 0){
+            for(int Item = 0; Item < _Size; Item++){
+                _ItemTrigramsStart[Item + 1] += _ItemTrigramsStart[Item];
+            }
+            _ItemTrigrams.resize(_ItemTrigramsStart[_Size]);
+        }
+    }
+
+    _CumulatedGains.assign(_TilesPerGroup + 1, 0);
+    for(int Tile = 0; Tile < _TilesPerGroup; Tile++){
+        const double Gain = Settings.SuggestionGain * std::pow(Settings.SuggestionDecay, Tile) * EXTENDED_COST_SCALE;
+        _CumulatedGains[Tile + 1] = _CumulatedGains[Tile] + std::llround(Gain);
+    }
+}
+
+bool ExtendedProblem::IsFeasible(void) const{
+    return _Groups <= EXTENDED_ACCESSIBLE_TILES
+        && _Groups * std::min(_TilesPerGroup, EXTENDED_ACCESSIBLE_TILES) >= static_cast<int>(sizeof(LAYOUT_ALPHABET) - 1)
+        && _Size >= static_cast<int>(EXTENDED_CHARS);
+}
+
+bool ExtendedProblem::IsAllowed(const int Item, const int Location) const{
+    if(IsFree(Item)){
+        return true;
+    }
+    if(!IsLetter(Item)){ // A punctuation missing from the trigrams, as in count_3l.txt, keeps its shipped slot
+        return _ItemTrigramsStart[Item] != _ItemTrigramsStart[Item + 1]
+            || Location == _Groups * _TilesPerGroup + Item - static_cast<int>(sizeof(LAYOUT_ALPHABET) - 1);
+    }
+    return _LocationGroups[Location] >= 0 && _LocationGroups[Location] < EXTENDED_ACCESSIBLE_TILES
+        && Location % _TilesPerGroup < EXTENDED_ACCESSIBLE_TILES;
+}
+
+bool ExtendedProblem::CanSwap(const std::vector<int> &Assignment, const int R, const int S) const{
+    const int X = Assignment[R];
+    const int Y = Assignment[S];
+    if((IsFree(X) && IsFree(Y)) || !IsAllowed(X, S) || !IsAllowed(Y, R)){
+        return false;
+    }
+    // A group keeps a char: a layout can't have a group of suggestion tiles only
+    return _LocationGroups[R] == _LocationGroups[S] || !(IsFree(X) ? IsLastChar(Assignment, S) : IsFree(Y) && IsLastChar(Assignment, R));
+}
+
+bool ExtendedProblem::IsLastChar(const std::vector<int> &Assignment, const int Location) const{
+    const int Group = _LocationGroups[Location];
+    if(Group < 0){
+        return false;
+    }
+    int Chars = 0;
+    for(int Tile = Group * _TilesPerGroup; Tile < (Group + 1) * _TilesPerGroup; Tile++){
+        Chars += IsFree(Assignment[Tile]) ? 0 : 1;
+    }
+    return Chars == 1;
+}
+
+bool ExtendedProblem::CanChangeCost(const int R, const int S) const{
+    if(_LocationGroups[R] >= 0 || _LocationGroups[S] >= 0){
+        return _LocationGroups[R] != _LocationGroups[S];
+    }
+    return _LocationPresses[R] != _LocationPresses[S];
+}
+
+std::vector<int> ExtendedProblem::AssignmentOf(const LetterLayout_t &Layout) const{
+    if(static_cast<int>(Layout.size()) != _Groups){
+        return {};
+    }
+    const std::string Alphabet = LAYOUT_ALPHABET;
+    std::vector<int> Assignment(_Size, -1);
+    for(int Group = 0; Group < _Groups; Group++){
+        if(static_cast<int>(Layout[Group].size()) > std::min(_TilesPerGroup, EXTENDED_ACCESSIBLE_TILES)){
+            return {};
+        }
+        for(int Tile = 0; Tile < static_cast<int>(Layout[Group].size()); Tile++){
+            Assignment[Group * _TilesPerGroup + Tile] = static_cast<int>(Alphabet.find(Layout[Group][Tile]));
+        }
+    }
+    for(int Slot = 0; Slot < EXTENDED_DPAD_SLOTS; Slot++){
+        Assignment[_Groups * _TilesPerGroup + Slot] = static_cast<int>(Alphabet.size()) + Slot;
+    }
+    int Free = EXTENDED_CHARS;
+    for(int &Item : Assignment){
+        Item = (Item < 0) ? Free++ : Item;
+    }
+    return Assignment;
+}
+
+int32_t ExtendedProblem::TrigramCost(const std::vector<int> &Where, const uint8_t (&Codes)[3]) const{
+    const int Location = Where[Codes[2]];
+    if(Codes[2] == _Size){ // The space after a punctuation: typed by its D-pad slot
+        return (_LocationGroups[Where[Codes[1]]] < 0) ? 0 : _LocationPresses[Location];
+    }
+    const int Group = _LocationGroups[Location];
+    if(Group < 0){
+        return _LocationPresses[Location];
+    }
+    // The buttons keep the selected group: it's the one of the last tile typed
+    int Selected = _LocationGroups[Where[Codes[1]]];
+    Selected = (Selected < 0) ? _LocationGroups[Where[Codes[0]]] : Selected;
+    return _LocationPresses[Location] + ((Selected < 0) ? _UnknownGroupCost : (Selected != Group) ? EXTENDED_COST_SCALE : 0);
+}
+
+ExtendedState_t ExtendedProblem::MakeState(const std::vector<int> &Assignment) const{
+    ExtendedState_t State = {Assignment, std::vector<int>(_Size + 1), {}, std::vector<int64_t>(_Groups, 0),
+                             std::vector<int>(_Groups, 0), 0};
+    for(int Location = 0; Location < _Size; Location++){
+        State.Where[Assignment[Location]] = Location;
+        const int Group = _LocationGroups[Location];
+        if(Group >= 0){
+            State.GroupFrees[Group] += IsFree(Assignment[Location]) ? 1 : 0;
+            State.GroupLoads[Group] += IsLetter(Assignment[Location]) ? _ItemCounts[Assignment[Location]] : 0;
+        }
+    }
+    State.Where[_Size] = _Size;
+
+    State.Costs.resize(_Trigrams.size());
+    for(int Index = 0; Index < static_cast<int>(_Trigrams.size()); Index++){
+        State.Costs[Index] = TrigramCost(State.Where, _Trigrams[Index].Codes);
+        State.Cost += _Trigrams[Index].Count * State.Costs[Index];
+    }
+    for(int Group = 0; Group < _Groups; Group++){
+        State.Cost -= GroupGain(State.GroupLoads[Group], State.GroupFrees[Group]);
+    }
+    return State;
+}
+
+int64_t ExtendedProblem::Cost(const std::vector<int> &Assignment) const{
+    return MakeState(Assignment).Cost;
+}
+
+int64_t ExtendedProblem::SwapDelta(ExtendedState_t &State, const int R, const int S) const{
+    const int X = State.Assignment[R];
+    const int Y = State.Assignment[S];
+    int64_t Delta = 0;
+
+    const int64_t LoadX = IsLetter(X) ? _ItemCounts[X] : 0;
+    const int64_t LoadY = IsLetter(Y) ? _ItemCounts[Y] : 0;
+    const int FreeX = IsFree(X) ? 1 : 0;
+    const int FreeY = IsFree(Y) ? 1 : 0;
+    const int GroupR = _LocationGroups[R];
+    const int GroupS = _LocationGroups[S];
+    if(GroupR != GroupS){ // Else the same group, or both on the D-pad: the gains don't change
+        if(GroupR >= 0){
+            Delta -= GroupGain(State.GroupLoads[GroupR] - LoadX + LoadY, State.GroupFrees[GroupR] - FreeX + FreeY)
+                   - GroupGain(State.GroupLoads[GroupR], State.GroupFrees[GroupR]);
+        }
+        if(GroupS >= 0){
+            Delta -= GroupGain(State.GroupLoads[GroupS] - LoadY + LoadX, State.GroupFrees[GroupS] - FreeY + FreeX)
+                   - GroupGain(State.GroupLoads[GroupS], State.GroupFrees[GroupS]);
+        }
+    }
+
+    std::swap(State.Where[X], State.Where[Y]);
+    for(int Ref = _ItemTrigramsStart[X]; Ref < _ItemTrigramsStart[X + 1]; Ref++){
+        const TrigramRef_t &Trigram = _ItemTrigrams[Ref];
+        Delta += Trigram.Count * (TrigramCost(State.Where, Trigram.Codes) - State.Costs[Trigram.Index]);
+    }
+    for(int Ref = _ItemTrigramsStart[Y]; Ref < _ItemTrigramsStart[Y + 1]; Ref++){
+        const TrigramRef_t &Trigram = _ItemTrigrams[Ref];
+        if(Trigram.Codes[0] != X && Trigram.Codes[1] != X && Trigram.Codes[2] != X){ // Else already counted with X
+            Delta += Trigram.Count * (TrigramCost(State.Where, Trigram.Codes) - State.Costs[Trigram.Index]);
+        }
+    }
+    std::swap(State.Where[X], State.Where[Y]);
+    return Delta;
+}
+
+void ExtendedProblem::Swap(ExtendedState_t &State, const int R, const int S, const int64_t Delta) const{
+    const int X = State.Assignment[R];
+    const int Y = State.Assignment[S];
+    const int64_t LoadX = IsLetter(X) ? _ItemCounts[X] : 0;
+    const int64_t LoadY = IsLetter(Y) ? _ItemCounts[Y] : 0;
+    const int FreeX = IsFree(X) ? 1 : 0;
+    const int FreeY = IsFree(Y) ? 1 : 0;
+    if(_LocationGroups[R] >= 0){
+        State.GroupLoads[_LocationGroups[R]] += LoadY - LoadX;
+        State.GroupFrees[_LocationGroups[R]] += FreeY - FreeX;
+    }
+    if(_LocationGroups[S] >= 0){
+        State.GroupLoads[_LocationGroups[S]] += LoadX - LoadY;
+        State.GroupFrees[_LocationGroups[S]] += FreeX - FreeY;
+    }
+
+    std::swap(State.Assignment[R], State.Assignment[S]);
+    std::swap(State.Where[X], State.Where[Y]);
+    for(const int Item : {X, Y}){
+        for(int Ref = _ItemTrigramsStart[Item]; Ref < _ItemTrigramsStart[Item + 1]; Ref++){
+            const TrigramRef_t &Trigram = _ItemTrigrams[Ref];
+            State.Costs[Trigram.Index] = TrigramCost(State.Where, Trigram.Codes);
+        }
+    }
+    State.Cost += Delta;
+}
+
+std::vector<int> ExtendedProblem::CharsOf(const std::vector<int> &Assignment, const int First, const int Count) const{
+    std::vector<int> Chars;
+    for(int Location = First; Location < First + Count; Location++){
+        if(!IsFree(Assignment[Location])){
+            Chars.push_back(Assignment[Location]);
+        }
+    }
+    // The cost doesn't depend on the order of the tiles of a group
+    std::stable_sort(Chars.begin(), Chars.end(), [this](const int A, const int B){ return _ItemCounts[A] > _ItemCounts[B]; });
+    return Chars;
+}
+
+/**
+ * @brief The text of a character.
+ * @param Item A character of the ExtendedProblem.
+ * @return The letter, or the char typed by the punctuation.
+ */
+static QString CharText(const int Item){
+    const int Letters = sizeof(LAYOUT_ALPHABET) - 1;
+    return (Item < Letters) ? QString(QChar::fromLatin1(LAYOUT_ALPHABET[Item]))
+                            : QString(DpadPunctuation()[Item - Letters].Text[1]);
+}
+
+QString ExtendedProblem::LayoutText(const std::vector<int> &Assignment) const{
+    QString Text;
+    QTextStream Out(&Text);
+    for(int Group = 0; Group < _Groups; Group++){
+        QStringList Lower;
+        for(const int Item : CharsOf(Assignment, Group * _TilesPerGroup, _TilesPerGroup)){
+            Lower << CharText(Item);
+        }
+        const QString Upper = Lower.join(' ').toUpper();
+        Out << "group " << static_cast<int>(NUMBER_OF_TILES) - Lower.length() << "\n"
+            << "lower " << Lower.join(' ') << "\n"
+            << "upper " << Upper << "\n"
+            << "outer " << Lower.join(' ') << "\n"
+            << "outer_upper " << Upper << "\n";
+    }
+    const int Letters = sizeof(LAYOUT_ALPHABET) - 1;
+    for(int Button = 0; Button < DpadButtons.length(); Button++){
+        Out << "button " << DpadButtons[Button]->IconName;
+        for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+            const int Item = Assignment[_Groups * _TilesPerGroup + Button * 2 + Shift];
+            Out << " " << (IsFree(Item) ? QString("NONE") : PunctuationName(DpadPunctuation()[Item - Letters]));
+        }
+        Out << "\n";
+    }
+    return Text;
+}
+
+bool ExtendedProblem::CheckLayout(const std::vector<int> &Assignment, QStringList &Errors) const{
+    // The shipped layout, its first groups and its D-pad replaced by those of the assignment
+    QStringList Lines = LayoutText(Assignment).split('\n', Qt::SkipEmptyParts);
+    int Group = -1;
+    for(const QString &Line : KeyboardLayout::Builtin().ToText().split('\n')){
+        Group += Line.startsWith("group ") ? 1 : 0;
+        const bool IsDpad = std::any_of(DpadButtons.begin(), DpadButtons.end(), [&Line](const PhysicalButton_t *Button){
+            return Line == "button " + Button->IconName || Line.startsWith("button " + Button->IconName + " ");
+        });
+        const bool IsReplacedGroup = Group >= 0 && Group < _Groups && !Line.startsWith("button ");
+        if(!IsDpad && !IsReplacedGroup){
+            Lines << Line;
+        }
+    }
+    KeyboardLayout Layout;
+    return KeyboardLayout::FromText(Lines.join('\n'), Layout, Errors);
+}
+
+LayoutCandidate_t ExtendedProblem::Candidate(const LayoutCandidate_t &Base, const std::vector<int> &Assignment) const{
+    LayoutCandidate_t Candidate = Base;
+    for(int Group = 0; Group < _Groups && Group < Candidate.Tiles[NOT_SHIFTED].length(); Group++){
+        CharGroup_t Lower;
+        CharGroup_t Upper;
+        for(const int Item : CharsOf(Assignment, Group * _TilesPerGroup, _TilesPerGroup)){
+            Lower.append(CharText(Item));
+            Upper.append(Lower.last().toUpper());
+        }
+        Candidate.Tiles[NOT_SHIFTED][Group] = Lower;
+        Candidate.Tiles[SHIFTED][Group] = Upper;
+        Candidate.SuggestionsMap[Group] = static_cast<uint8_t>(NUMBER_OF_TILES - Lower.length());
+    }
+
+    const int Letters = sizeof(LAYOUT_ALPHABET) - 1;
+    for(PhysicalButton_t &Button : Candidate.Buttons){
+        for(int Dpad = 0; Dpad < DpadButtons.length(); Dpad++){
+            if(Button.IconName != DpadButtons[Dpad]->IconName){
+                continue;
+            }
+            for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+                const int Item = Assignment[_Groups * _TilesPerGroup + Dpad * 2 + Shift];
+                Button.Features[Shift] = IsFree(Item) ? FEATURE_NONE : DpadPunctuation()[Item - Letters];
+            }
+        }
+    }
+    return Candidate;
+}
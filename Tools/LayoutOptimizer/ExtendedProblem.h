@@ -0,0 +1,340 @@
+/* ExtendedProblem.h */
+
+#ifndef EXTENDEDPROBLEM_H
+#define EXTENDEDPROBLEM_H
+
+#include <cstdint>
+#include <vector>
+
+#include <QString>
+#include <QStringList>
+#include <QTextStream>
+
+#include "LayoutEvaluator.h"
+#include "LayoutProblem.h"
+
+/**
+ * @def EXTENDED_CHARS
+ * @brief The characters placed by the extended problem: the letters of LAYOUT_ALPHABET, then the punctuation of the
+ * D-pad, in the order of the shipped D-pad slots (see DpadPunctuation).
+ */
+#define EXTENDED_CHARS (sizeof(LAYOUT_ALPHABET) - 1 + 8)
+
+/**
+ * @def EXTENDED_DPAD_SLOTS
+ * @brief The features of the D-pad: 4 directions, NOT_SHIFTED and SHIFTED.
+ */
+#define EXTENDED_DPAD_SLOTS 8
+
+/**
+ * @def EXTENDED_ACCESSIBLE_TILES
+ * @brief The letters stay on the first 6 tiles of the first 6 groups, so the layout can become a 6x6 one.
+ */
+#define EXTENDED_ACCESSIBLE_TILES 6
+
+/**
+ * @def EXTENDED_COST_SCALE
+ * @brief The costs are in 1/EXTENDED_COST_SCALE moves, to stay integers with the suggestion gains.
+ */
+#define EXTENDED_COST_SCALE 100
+
+/**
+ * @brief A sequence of three characters and its count. The codes are the items of the ExtendedProblem, or its space.
+ */
+struct Trigram_t {
+    uint8_t Codes[3]; /**< The characters, in typing order. */
+    int64_t Count;    /**< Its occurrences. */
+};
+
+/**
+ * @brief The trigrams involving an item, stored next to each other for the swap deltas.
+ */
+struct TrigramRef_t {
+    uint8_t Codes[3]; /**< A copy of the characters of the trigram. */
+    int32_t Index;    /**< The trigram, in the kept trigrams of the ExtendedProblem. */
+    int64_t Count;    /**< A copy of its occurrences. */
+};
+
+/**
+ * @brief The parameters of the extended problem.
+ */
+struct ExtendedSettings_t {
+    int TilesPerGroup;      /**< NUMBER_OF_TILES, or EXTENDED_ACCESSIBLE_TILES for a 6x6 layout. */
+    double SuggestionGain;  /**< Moves saved per letter typed in a group by its first suggestion tile. */
+    double SuggestionDecay; /**< Ratio of the gain of each following suggestion tile to the previous one. */
+    int MaxTrigrams;        /**< The most frequent trigrams kept in the objective. */
+};
+
+/**
+ * @brief The state of a search: an assignment and what the swap deltas read from it.
+ */
+struct ExtendedState_t {
+    std::vector<int> Assignment;     /**< The item at each location. */
+    std::vector<int> Where;          /**< The location of each item, then of the space. */
+    std::vector<int32_t> Costs;      /**< The cost of each trigram, scaled, its count excluded. */
+    std::vector<int64_t> GroupLoads; /**< The letters typed in each group. */
+    std::vector<int> GroupFrees;     /**< The suggestion tiles of each group. */
+    int64_t Cost;                    /**< The cost of the assignment. */
+};
+
+/**
+ * @brief Counts the trigrams of a file in the count_2l.txt format, such as count_3l.txt.
+ * @param Path A file holding, on each line, three characters and their count separated by a tab.
+ * @param Counts Receives the counts, [First][Second][Third] by ExtendedCode; the other trigrams are ignored.
+ * @return False if the file can't be read.
+ */
+bool LoadTrigramCounts(const QString &Path, std::vector<int64_t> &Counts);
+
+/**
+ * @brief Counts the trigrams of a text, each line being followed by a space as typed by the LayoutEvaluator.
+ * @param Corpus The text, read until its end.
+ * @param MaxLines Stop after this number of lines, 0 to read the whole corpus.
+ * @param Counts Receives the counts, [First][Second][Third] by ExtendedCode. A character with no code splits the text.
+ */
+void CountTrigrams(QTextStream &Corpus, const int MaxLines, std::vector<int64_t> &Counts);
+
+/**
+ * @brief The code of a character in the trigram counts.
+ * @param Character A character of a text, in any case.
+ * @return Its item in the ExtendedProblem, EXTENDED_CHARS for a space, -1 for the other characters.
+ */
+int ExtendedCode(const QChar Character);
+
+/**
+ * @brief The ExtendedProblem class places the letters, the D-pad punctuation and the suggestion tiles together.
+ *
+ * @details The locations are the tiles of the letter groups, then the EXTENDED_DPAD_SLOTS slots of the D-pad. The
+ * items are the EXTENDED_CHARS characters, then free items filling the remaining locations: a free item on a tile is
+ * a suggestion tile of its group, on the D-pad an unmapped slot. A punctuation can thus leave the D-pad for a tile,
+ * and each group has as many suggestion tiles as the search finds worth it. The letters are kept on the tiles
+ * allowed by EXTENDED_ACCESSIBLE_TILES.
+ *
+ * The cost of a character is read from its trigram, since a button keeps the selected group: a tile costs a tile
+ * move, plus a group move if its group differs from the one of the previous tile typed, found in the two previous
+ * characters (else a move in (groups - 1) / groups of the cases). A D-pad slot costs a press, plus a shift press if
+ * it's SHIFTED, and its punctuation types the following space. The suggestion tiles of a group save
+ * SuggestionGain moves per letter typed in it for the first one, SuggestionDecay times less for each next one.
+ *
+ * The objective is sparse: only the MaxTrigrams most frequent trigrams are kept, and each item has the list of the
+ * trigrams it's part of, stored contiguously. Swapping two items only recomputes their trigrams and the gains of
+ * their two groups.
+ */
+class ExtendedProblem {
+public: // Methods
+    /**
+     * @brief Constructor of the ExtendedProblem.
+     * @param Counts The trigram counts, as filled by LoadTrigramCounts or CountTrigrams.
+     * @param Groups The number of letter groups, at most EXTENDED_ACCESSIBLE_TILES.
+     * @param Settings The parameters of the problem.
+     */
+    ExtendedProblem(const std::vector<int64_t> &Counts, const int Groups, const ExtendedSettings_t &Settings);
+
+    /**
+     * @brief Getter for the number of locations, and of items.
+     * @return The tiles of the groups plus the D-pad slots.
+     */
+    inline int Size(void) const { return _Size; }
+
+    /**
+     * @brief Getter for the group of a location.
+     * @param Location The location.
+     * @return Its letter group, -1 for a D-pad slot.
+     */
+    inline int GroupOf(const int Location) const { return _LocationGroups[Location]; }
+
+    /**
+     * @brief Tells if an item is free: a suggestion tile on a tile, an unmapped slot on the D-pad.
+     * @param Item The item.
+     * @return False for the EXTENDED_CHARS characters.
+     */
+    inline bool IsFree(const int Item) const { return Item >= static_cast<int>(EXTENDED_CHARS); }
+
+    /**
+     * @brief Tells if the letters fit on the tiles they're allowed on.
+     * @return False if the groups are too few for LAYOUT_ALPHABET.
+     */
+    bool IsFeasible(void) const;
+
+    /**
+     * @brief Tells if an item may be placed on a location.
+     * @param Item The item.
+     * @param Location The location.
+     * @return False for a letter out of the accessible tiles or on the D-pad, and for a punctuation that is in no kept
+     * trigram out of its shipped slot.
+     */
+    bool IsAllowed(const int Item, const int Location) const;
+
+    /**
+     * @brief Tells if the items of two locations may be swapped.
+     * @param Assignment The item at each location.
+     * @param R The first location.
+     * @param S The second location.
+     * @return False if an item is not allowed on the other location, if both are free, or if a group would be left with
+     * no char.
+     */
+    bool CanSwap(const std::vector<int> &Assignment, const int R, const int S) const;
+
+    /**
+     * @brief Tells if swapping the items of two locations can change the cost, whatever the items.
+     * @param R The first location.
+     * @param S The second location.
+     * @return False for two tiles of the same group, and for two D-pad slots of the same shift state.
+     */
+    bool CanChangeCost(const int R, const int S) const;
+
+    /**
+     * @brief Places the letters as a layout, with the shipped D-pad.
+     * @param Layout The letters of each group; the other tiles are suggestion tiles.
+     * @return The assignment, empty if the layout doesn't fit the problem.
+     */
+    std::vector<int> AssignmentOf(const LetterLayout_t &Layout) const;
+
+    /**
+     * @brief Computes the cost of an assignment from scratch.
+     * @param Assignment The item at each location.
+     * @return The cost, in 1/EXTENDED_COST_SCALE moves.
+     */
+    int64_t Cost(const std::vector<int> &Assignment) const;
+
+    /**
+     * @brief Builds the state of a search from an assignment.
+     * @param Assignment The item at each location.
+     * @return The state.
+     */
+    ExtendedState_t MakeState(const std::vector<int> &Assignment) const;
+
+    /**
+     * @brief Computes the cost variation of swapping the items of two locations, from the trigrams of both items.
+     * @param State The state, left unchanged.
+     * @param R The first location.
+     * @param S The second location.
+     * @return The cost after the swap minus the cost before.
+     */
+    int64_t SwapDelta(ExtendedState_t &State, const int R, const int S) const;
+
+    /**
+     * @brief Swaps the items of two locations and updates the state.
+     * @param State The state.
+     * @param R The first location.
+     * @param S The second location.
+     * @param Delta The delta of the swap, as computed by SwapDelta.
+     */
+    void Swap(ExtendedState_t &State, const int R, const int S, const int64_t Delta) const;
+
+    /**
+     * @brief Prints an assignment as the groups and buttons of a layout file.
+     * @param Assignment The item at each location.
+     * @return The lines to paste in a copy of Layouts/Default.layout, in place of its first groups and its D-pad. The
+     * suggestion tiles of a group are the NUMBER_OF_TILES tiles of the wheel left by its chars.
+     */
+    QString LayoutText(const std::vector<int> &Assignment) const;
+
+    /**
+     * @brief Loads the text of an assignment in the shipped layout, as a copy of Layouts/Default.layout would be.
+     * @param Assignment The item at each location.
+     * @param Errors Receives the reasons why KeyboardLayout::FromText rejected it.
+     * @return True if the layout is valid.
+     */
+    bool CheckLayout(const std::vector<int> &Assignment, QStringList &Errors) const;
+
+    /**
+     * @brief Builds the candidate of an assignment, to replay a corpus against it.
+     * @param Base The candidate holding the other groups and buttons, such as ShippedCandidate().
+     * @param Assignment The item at each location.
+     * @return The candidate.
+     */
+    LayoutCandidate_t Candidate(const LayoutCandidate_t &Base, const std::vector<int> &Assignment) const;
+
+    /**
+     * @brief Getter for the share of the counts kept in the objective.
+     * @return The counts of the kept trigrams over the counts of all of them.
+     */
+    inline double KeptMass(void) const { return _KeptMass; }
+
+    /**
+     * @brief Getter for the trigrams kept in the objective.
+     * @return At most MaxTrigrams.
+     */
+    inline int TrigramsCount(void) const { return static_cast<int>(_Trigrams.size()); }
+
+private: // Methods
+    /**
+     * @brief The cost of a trigram, its count excluded.
+     * @param Where The location of each item, then of the space.
+     * @param Codes The characters of the trigram.
+     * @return The cost of typing its third character, in 1/EXTENDED_COST_SCALE moves.
+     */
+    int32_t TrigramCost(const std::vector<int> &Where, const uint8_t (&Codes)[3]) const;
+
+    /**
+     * @brief The suggestion gain of a group.
+     * @param Load The letters typed in the group.
+     * @param Frees The suggestion tiles of the group.
+     * @return The moves saved, in 1/EXTENDED_COST_SCALE moves.
+     */
+    inline int64_t GroupGain(const int64_t Load, const int Frees) const { return Load * _CumulatedGains[Frees]; }
+
+    /**
+     * @brief The characters of a group or of a D-pad slot, by decreasing count.
+     * @param Assignment The item at each location.
+     * @param First The first location.
+     * @param Count The number of locations.
+     * @return The items, the free ones excluded.
+     */
+    std::vector<int> CharsOf(const std::vector<int> &Assignment, const int First, const int Count) const;
+
+    /**
+     * @brief Tells if a location holds the only char of its group.
+     * @param Assignment The item at each location.
+     * @param Location The location.
+     * @return False for a D-pad slot, and for a group holding other chars or none.
+     */
+    bool IsLastChar(const std::vector<int> &Assignment, const int Location) const;
+
+    inline bool IsLetter(const int Item) const { return Item < static_cast<int>(sizeof(LAYOUT_ALPHABET) - 1); }
+
+private: // Attributes
+    int _Groups;
+    int _TilesPerGroup;
+    int _Size;
+
+    /**
+     * @brief The cost of a group move from an unknown group: (groups - 1) / groups moves.
+     */
+    int32_t _UnknownGroupCost;
+
+    /**
+     * @brief The group of each location, -1 for the D-pad; the last one is the space, on a button.
+     */
+    std::vector<int> _LocationGroups;
+
+    /**
+     * @brief The cost of a press on each location, the shift included; the last one is the space.
+     */
+    std::vector<int32_t> _LocationPresses;
+
+    /**
+     * @brief The kept trigrams, by decreasing count.
+     */
+    std::vector<Trigram_t> _Trigrams;
+
+    /**
+     * @brief The trigrams of each item, item after item; those of Item start at _ItemTrigramsStart[Item].
+     */
+    std::vector<TrigramRef_t> _ItemTrigrams;
+    std::vector<int> _ItemTrigramsStart;
+
+    /**
+     * @brief The occurrences of each item, as the third character of a trigram.
+     */
+    std::vector<int64_t> _ItemCounts;
+
+    /**
+     * @brief The gain of the first N suggestion tiles of a group, per letter typed in it, scaled.
+     */
+    std::vector<int64_t> _CumulatedGains;
+
+    double _KeptMass;
+};
+
+#endif // EXTENDEDPROBLEM_H
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "ExtendedSolver.h"
+
+ExtendedSolver::ExtendedSolver(const ExtendedProblem &Problem)
+    : _Problem(Problem)
+{
+    std::vector<int> AllowedLocations(_Problem.Size(), 0);
+    for(int R = 0; R < _Problem.Size(); R++){
+        for(int S = R + 1; S < _Problem.Size(); S++){
+            if(_Problem.CanChangeCost(R, S)){
+                _Swaps.emplace_back(R, S);
+            }
+        }
+        for(int Item = 0; Item < _Problem.Size(); Item++){
+            AllowedLocations[Item] += _Problem.IsAllowed(Item, R) ? 1 : 0;
+        }
+    }
+    _Items.resize(_Problem.Size());
+    std::iota(_Items.begin(), _Items.end(), 0);
+    std::stable_sort(_Items.begin(), _Items.end(),
+                     [&AllowedLocations](const int A, const int B){ return AllowedLocations[A] < AllowedLocations[B]; });
+}
+
+QapSolution_t ExtendedSolver::RunTabuSearch(const uint64_t Seed, const int64_t Iterations, int64_t &EvaluatedSwaps) const{
+    const int N = _Problem.Size();
+    std::mt19937_64 Generator(Seed);
+
+    /* Random start: each item, the most constrained first, on the first
+     * allowed location left of a shuffled order. The first chars go to
+     * the groups holding none yet, as CanSwap never empties a group. */
+    std::vector<int> Locations(N);
+    std::iota(Locations.begin(), Locations.end(), 0);
+    std::shuffle(Locations.begin(), Locations.end(), Generator);
+    std::vector<int> Start(N, -1);
+    std::vector<bool> HasChar(N, false);
+    for(const int Item : _Items){
+        for(const bool NewGroup : {true, false}){
+            const auto Found = std::find_if(Locations.begin(), Locations.end(), [this, Item, NewGroup, &HasChar](const int Location){
+                return Location >= 0 && _Problem.IsAllowed(Item, Location)
+                    && (!NewGroup || (!_Problem.IsFree(Item) && _Problem.GroupOf(Location) >= 0 && !HasChar[_Problem.GroupOf(Location)]));
+            });
+            if(Found != Locations.end()){
+                Start[*Found] = Item;
+                if(!_Problem.IsFree(Item) && _Problem.GroupOf(*Found) >= 0){
+                    HasChar[_Problem.GroupOf(*Found)] = true;
+                }
+                *Found = -1;
+                break;
+            }
+        }
+    }
+    ExtendedState_t Current = _Problem.MakeState(Start);
+
+    QapSolution_t Best = {Current.Assignment, Current.Cost, 0};
+    if(_Swaps.empty()){ // Every assignment costs the same
+        return Best;
+    }
+
+    // Tabu[Location * N + Item]: last iteration at which placing Item back at Location is forbidden
+    std::vector<int64_t> Tabu(N * N);
+    for(int Location = 0; Location < N; Location++){
+        for(int Item = 0; Item < N; Item++){
+            Tabu[Location * N + Item] = -(static_cast<int64_t>(N) * Location + Item);
+        }
+    }
+
+    const int TenureMin = std::max(1, N * TABU_TENURE_MIN / 100);
+    const int TenureMax = std::max(TenureMin, N * TABU_TENURE_MAX / 100);
+    std::uniform_int_distribution<int> TenureDistribution(TenureMin, TenureMax);
+    int Tenure = TenureDistribution(Generator);
+    const int64_t Aspiration = static_cast<int64_t>(TABU_ASPIRATION) * N * N;
+
+    for(int64_t Iteration = 1; Iteration <= Iterations; Iteration++){
+        int RetainedR = -1;
+        int RetainedS = -1;
+        int64_t MinDelta = std::numeric_limits<int64_t>::max();
+        bool AlreadyAspired = false;
+
+        for(const std::pair<int, int> &Swap : _Swaps){
+            const int R = Swap.first;
+            const int S = Swap.second;
+            if(!_Problem.CanSwap(Current.Assignment, R, S)){
+                continue;
+            }
+            const int64_t SwapTabuR = Tabu[R * N + Current.Assignment[S]];
+            const int64_t SwapTabuS = Tabu[S * N + Current.Assignment[R]];
+            const int64_t SwapDelta = _Problem.SwapDelta(Current, R, S);
+            EvaluatedSwaps++;
+            const bool Authorized = SwapTabuR < Iteration || SwapTabuS < Iteration;
+            const bool Aspired = SwapTabuR < Iteration - Aspiration || SwapTabuS < Iteration - Aspiration
+                              || Current.Cost + SwapDelta < Best.Cost;
+
+            if((Aspired && !AlreadyAspired)
+               || (Aspired && AlreadyAspired && SwapDelta < MinDelta)
+               || (!Aspired && !AlreadyAspired && Authorized && SwapDelta < MinDelta)){
+                RetainedR = R;
+                RetainedS = S;
+                MinDelta = SwapDelta;
+                AlreadyAspired = AlreadyAspired || Aspired;
+            }
+        }
+
+        if(RetainedR < 0){ // Every move is tabu: wait for the tenures to expire
+            continue;
+        }
+
+        _Problem.Swap(Current, RetainedR, RetainedS, MinDelta);
+        Tabu[RetainedR * N + Current.Assignment[RetainedS]] = Iteration + Tenure;
+        Tabu[RetainedS * N + Current.Assignment[RetainedR]] = Iteration + Tenure;
+
+        if(Current.Cost < Best.Cost){
+            Best.Assignment = Current.Assignment;
+            Best.Cost = Current.Cost;
+        }
+
+        if(Iteration % (2 * TenureMax) == 0){
+            Tenure = TenureDistribution(Generator);
+        }
+    }
+    return Best;
+}
+
+TabuReport_t ExtendedSolver::Solve(const TabuSettings_t &Settings) const{
+    return RunStarts(Settings, [this, &Settings](const uint64_t Seed, int64_t &EvaluatedSwaps){
+        return RunTabuSearch(Seed, Settings.Iterations, EvaluatedSwaps);
+    });
+}
@@ -0,0 +1,65 @@
+/* ExtendedSolver.h */
+
+#ifndef EXTENDEDSOLVER_H
+#define EXTENDEDSOLVER_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ExtendedProblem.h"
+#include "QapSolver.h"
+
+/**
+ * @brief The ExtendedSolver class solves an ExtendedProblem with the tabu search of the QapSolver.
+ *
+ * @details The objective isn't quadratic, so the deltas are not kept from an iteration to the next one: each
+ * iteration computes the delta of every allowed swap from the sparse trigrams of its two items, and performs the best
+ * one that is not tabu, with the tenures and the aspiration of the QapSolver. The swaps that can never change the cost,
+ * such as two tiles of the same group, are never considered.
+ *
+ * The random starts respect the allowed locations of the letters. As for the QapSolver, the result only depends on the
+ * seeds, not on the number of threads.
+ */
+class ExtendedSolver {
+public: // Methods
+    /**
+     * @brief Constructor of the ExtendedSolver.
+     * @param Problem The problem to solve, which must outlive the solver.
+     */
+    explicit ExtendedSolver(const ExtendedProblem &Problem);
+
+    /**
+     * @brief Runs the starts of a multi-start tabu search, spread over several threads.
+     * @param Settings The parameters of the search.
+     * @return The best assignment found, the lowest start index winning ties.
+     */
+    TabuReport_t Solve(const TabuSettings_t &Settings) const;
+
+    /**
+     * @brief Runs a single tabu search from a random assignment.
+     * @param Seed The seed of the random assignment and of the tabu tenures.
+     * @param Iterations The swaps to perform.
+     * @param EvaluatedSwaps Incremented by the number of swap deltas computed.
+     * @return The best assignment met during the search.
+     */
+    QapSolution_t RunTabuSearch(const uint64_t Seed, const int64_t Iterations, int64_t &EvaluatedSwaps) const;
+
+private: // Attributes
+    /**
+     * @brief The problem to solve.
+     */
+    const ExtendedProblem &_Problem;
+
+    /**
+     * @brief The swaps worth considering, as (R, S) pairs with R < S: the pairs whose swap can change the cost.
+     */
+    std::vector<std::pair<int, int>> _Swaps;
+
+    /**
+     * @brief The items, by increasing number of allowed locations: the order in which a random start places them.
+     */
+    std::vector<int> _Items;
+};
+
+#endif // EXTENDEDSOLVER_H
@@ -0,0 +1,395 @@
+#include <array>
+
+#include <QCache>
+#include <QHash>
+#include <QStringList>
+#include <QtConcurrent/QtConcurrent>
+
+#include "LayoutEvaluator.h"
+
+/**
+ * @def UNREACHABLE
+ * @brief The moves of a path that doesn't exist.
+ */
+#define UNREACHABLE 0xFFFFFFFFU
+
+/**
+ * @brief The buttons of the shipped mapping.
+ */
+static const QVector<const PhysicalButton_t*> ShippedButtons = {
+    &Button_X, &Button_Y, &Button_LB, &Button_RB, &Button_LT, &Dpad_UP, &Dpad_DOWN, &Dpad_LEFT, &Dpad_RIGHT
+};
+
+/**
+ * @brief Describes how to reach a character: a tile of the inner tile group, or a button.
+ */
+struct CharKey_t {
+    bool IsButton;             /**< True if the character is typed with a button, false if it's on a tile. */
+    uint8_t Group;             /**< The group of the tile. Unused for buttons. */
+    ShiftState_t Shift;        /**< The shift state required to reach the character. */
+    FeatureType_t FeatureType; /**< The type of the button's feature. Unused for tiles. */
+};
+
+/**
+ * @brief The moves of a path through a word, small enough to be cached for the frequent words. In 32 bits: a long
+ * token of the corpus, such as a URL, may take more than 65535 moves.
+ */
+struct PathCost_t {
+    uint32_t Moves;
+    uint32_t GroupMoves;
+    uint32_t TileMoves;
+    uint32_t ShiftPresses;
+    uint32_t ButtonPresses;
+    uint32_t Suggestions;
+};
+
+/**
+ * @brief The costs of a word followed by a space, [EntryGroup * NUMBER_OF_TILES + ExitGroup].
+ */
+using WordCosts_t = std::array<PathCost_t, NUMBER_OF_TILES * NUMBER_OF_TILES>;
+
+/**
+ * @brief The moves of a path through a line.
+ */
+struct LineCost_t {
+    qint64 Moves;
+    qint64 GroupMoves;
+    qint64 TileMoves;
+    qint64 ShiftPresses;
+    qint64 ButtonPresses;
+    qint64 Suggestions;
+};
+
+static const PathCost_t UnreachablePath = {UNREACHABLE, 0, 0, 0, 0, 0};
+static const LineCost_t UnreachableLine = {-1, 0, 0, 0, 0, 0};
+
+/**
+ * @brief The CandidateReplay class types the corpus with a candidate, keeping its state from a chunk to the next one.
+ */
+class CandidateReplay {
+public: // Methods
+    CandidateReplay(const LayoutCandidate_t &Candidate, const QSharedPointer<const Trie> &Dictionary, const bool UseSuggestions);
+
+    /**
+     * @brief Types lines of the corpus, each one followed by a space.
+     * @param Lines The lines to type.
+     */
+    void ReplayLines(const QStringList &Lines);
+
+    /**
+     * @brief Getter for the moves.
+     * @return The moves accumulated since the construction.
+     */
+    MoveCounts_t GetCounts(void) const { return _Counts; }
+
+private: // Methods
+    /**
+     * @brief Replaces the characters of the corpus that have a typeable equivalent, and drops the other ones.
+     * @param Line The line to normalize.
+     * @return The normalized line.
+     */
+    QString Normalize(const QString &Line);
+
+    /**
+     * @brief Getter for the costs of a word, from the cache if it's a frequent one.
+     * @param Word The normalized word, without its space.
+     * @return The costs, valid until the next call.
+     */
+    const WordCosts_t &GetWordCosts(const QString &Word);
+
+    /**
+     * @brief Computes the cheapest path through a word followed by a space, from each entry group to each exit group.
+     * @param Word The normalized word, without its space.
+     * @return The costs of the word.
+     */
+    WordCosts_t ComputeWordCosts(const QString &Word) const;
+
+private: // Attributes
+    LayoutCandidate_t _Candidate;
+    QSharedPointer<const Trie> _Dictionary;
+    bool _UseSuggestions;
+    QHash<QChar, CharKey_t> _CharKeys;
+    QCache<QString, WordCosts_t> _Cache;
+    uint8_t _CurrentGroup;
+    MoveCounts_t _Counts;
+};
+
+/**
+ * @brief Adds a step to a path.
+ * @param Path The path so far.
+ * @param Step The moves of the step, its Moves being ignored.
+ * @return The path followed by the step.
+ */
+static PathCost_t Extend(const PathCost_t &Path, const PathCost_t &Step){
+    PathCost_t Next = {0,
+                       static_cast<uint32_t>(Path.GroupMoves + Step.GroupMoves),
+                       static_cast<uint32_t>(Path.TileMoves + Step.TileMoves),
+                       static_cast<uint32_t>(Path.ShiftPresses + Step.ShiftPresses),
+                       static_cast<uint32_t>(Path.ButtonPresses + Step.ButtonPresses),
+                       static_cast<uint32_t>(Path.Suggestions + Step.Suggestions)};
+    Next.Moves = Next.GroupMoves + Next.TileMoves + Next.ShiftPresses + Next.ButtonPresses;
+    return Next;
+}
+
+/**
+ * @brief Keeps the cheapest of two paths, the current one on ties.
+ * @param Current The best path known, updated.
+ * @param Candidate The new path.
+ */
+static void Relax(PathCost_t &Current, const PathCost_t &Candidate){
+    if(Candidate.Moves < Current.Moves){
+        Current = Candidate;
+    }
+}
+
+CandidateReplay::CandidateReplay(const LayoutCandidate_t &Candidate, const QSharedPointer<const Trie> &Dictionary, const bool UseSuggestions)
+    : _Candidate(Candidate)
+    , _Dictionary(Dictionary)
+    , _UseSuggestions(UseSuggestions)
+    , _Cache(EVALUATOR_CACHE_TOKENS)
+    , _CurrentGroup(0)
+    , _Counts({0, 0, 0, 0, 0, 0, 0, 0})
+{
+    // Same precedence as gp4k-simulator: a character both on a tile and a button is typed with the first one found
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        for(uint8_t Group = 0; Group < _Candidate.Tiles[Shift].length() && Group < NUMBER_OF_TILES; Group++){
+            for(const QString &Chars : _Candidate.Tiles[Shift][Group]){
+                // Emotes are made of several code units: they can't be found in a corpus read char by char
+                if(Chars.length() == 1 && !_CharKeys.contains(Chars[0])){
+                    _CharKeys.insert(Chars[0], {false, Group, Shift, NO_CHAR_CAT});
+                }
+            }
+        }
+        for(const PhysicalButton_t &Button : _Candidate.Buttons){
+            const feature_t &Feature = Button.Features[Shift];
+            if(Feature.FeatureType == PUNCTUATION || Feature.FeatureType == WORD_CONNECTOR){
+                const QChar Character = Feature.Text[1];
+                if(!_CharKeys.contains(Character)){
+                    _CharKeys.insert(Character, {true, 0, Shift, Feature.FeatureType});
+                }
+            }
+        }
+    }
+}
+
+QString CandidateReplay::Normalize(const QString &Line){
+    QString Normalized;
+    Normalized.reserve(Line.length());
+    for(QChar Character : Line){
+        if(Character == '\'' || Character == QChar(0x2018)){ Character = QChar(0x2019); } // The apostrophe of the layout is ’
+        if(Character.isSpace()){ Character = ' '; }
+
+        if(Character == ' ' || _CharKeys.contains(Character)){
+            Normalized.append(Character);
+        }else{
+            _Counts.SkippedCharacters++;
+        }
+    }
+    return Normalized;
+}
+
+const WordCosts_t &CandidateReplay::GetWordCosts(const QString &Word){
+    WordCosts_t *Costs = _Cache.object(Word);
+    if(Costs == nullptr){
+        Costs = new WordCosts_t(ComputeWordCosts(Word));
+        _Cache.insert(Word, Costs);
+    }
+    return *Costs;
+}
+
+WordCosts_t CandidateReplay::ComputeWordCosts(const QString &Word) const{
+    const int Length = Word.length();
+    const int Groups = qMin<int>(_Candidate.Tiles[NOT_SHIFTED].length(), NUMBER_OF_TILES);
+
+    /* The suggestions only depend on the buffer and the group: they are
+     * sought once per position, then reused for every entry group. */
+    QVector<QVector<uint8_t>> SuggestionGroups(Length);
+    int BufferStart = 0;
+    for(int Position = 0; Position < Length; Position++){
+        if(_UseSuggestions && BufferStart < Position){
+            const QString Buffer = Word.mid(BufferStart, Position - BufferStart).toLower();
+            const QString Ending = Word.mid(Position);
+            for(uint8_t Group = 0; Group < Groups; Group++){
+                const int NumberSuggestionTiles = _Candidate.SuggestionsMap.value(Group, 0);
+                if(NumberSuggestionTiles == 0){ continue; }
+                const QVector<QString> Offered = _Dictionary->Suggest(Buffer, _Candidate.Tiles[NOT_SHIFTED][Group]);
+                for(int SuggestionIndex = 0; SuggestionIndex < qMin(NumberSuggestionTiles, Offered.length()); SuggestionIndex++){
+                    // What is typed is the suggestion minus the buffer, so the typed part of the word can hold caps
+                    if(Offered[SuggestionIndex].mid(Position - BufferStart) == Ending){
+                        SuggestionGroups[Position].append(Group);
+                        break;
+                    }
+                }
+            }
+        }
+        const CharKey_t Key = _CharKeys.value(Word[Position]);
+        if(Key.IsButton && Key.FeatureType == PUNCTUATION){
+            BufferStart = Position + 1;
+        }
+    }
+
+    WordCosts_t Costs;
+    Costs.fill(UnreachablePath);
+    QVector<PathCost_t> Paths((Length + 1) * NUMBER_OF_TILES);
+    auto PathIndex = [](const int Position, const uint8_t Group){ return Position * NUMBER_OF_TILES + Group; };
+
+    for(uint8_t Entry = 0; Entry < Groups; Entry++){
+        Paths.fill(UnreachablePath);
+        Paths[PathIndex(0, Entry)] = {0, 0, 0, 0, 0, 0};
+        PathCost_t *Exits = &Costs[Entry * NUMBER_OF_TILES];
+
+        for(int Position = 0; Position < Length; Position++){
+            const CharKey_t Key = _CharKeys.value(Word[Position]);
+            const uint32_t Shift = (Key.Shift == SHIFTED) ? 1 : 0;
+            for(uint8_t Group = 0; Group < Groups; Group++){
+                const PathCost_t &Path = Paths[PathIndex(Position, Group)];
+                if(Path.Moves == UNREACHABLE){ continue; }
+
+                if(!Key.IsButton){
+                    const uint32_t GroupMove = (Key.Group != Group) ? 1 : 0;
+                    Relax(Paths[PathIndex(Position + 1, Key.Group)], Extend(Path, {0, GroupMove, 1, Shift, 0, 0}));
+                }else if(Key.FeatureType == WORD_CONNECTOR){
+                    Relax(Paths[PathIndex(Position + 1, Group)], Extend(Path, {0, 0, 0, Shift, 1, 0}));
+                }else if(Position + 1 == Length){ // Punctuations are followed by a space
+                    Relax(Exits[Group], Extend(Path, {0, 0, 0, Shift, 1, 0}));
+                }else{ // ... that must be erased when the corpus does not have one
+                    Relax(Paths[PathIndex(Position + 1, Group)], Extend(Path, {0, 0, 0, Shift, 2, 0}));
+                }
+
+                for(const uint8_t SuggestionGroup : SuggestionGroups[Position]){ // Types the end of the word and a space
+                    const uint32_t GroupMove = (SuggestionGroup != Group) ? 1 : 0;
+                    Relax(Exits[SuggestionGroup], Extend(Path, {0, GroupMove, 1, 0, 0, 1}));
+                }
+            }
+        }
+
+        for(uint8_t Group = 0; Group < Groups; Group++){
+            const PathCost_t &Path = Paths[PathIndex(Length, Group)];
+            if(Path.Moves != UNREACHABLE){
+                Relax(Exits[Group], Extend(Path, {0, 0, 0, 0, 1, 0})); // The space
+            }
+        }
+    }
+    return Costs;
+}
+
+void CandidateReplay::ReplayLines(const QStringList &Lines){
+    for(const QString &Line : Lines){
+        const QString Target = Normalize(Line);
+        _Counts.Characters += Target.length() + 1; // The end of line is typed as a space
+
+        std::array<LineCost_t, NUMBER_OF_TILES> Paths;
+        Paths.fill(UnreachableLine);
+        Paths[_CurrentGroup] = {0, 0, 0, 0, 0, 0};
+
+        for(const QString &Word : Target.split(' ')){
+            _Counts.Words += Word.isEmpty() ? 0 : 1;
+            const WordCosts_t &Costs = GetWordCosts(Word);
+
+            std::array<LineCost_t, NUMBER_OF_TILES> NextPaths;
+            NextPaths.fill(UnreachableLine);
+            for(uint8_t Entry = 0; Entry < NUMBER_OF_TILES; Entry++){
+                const LineCost_t &Path = Paths[Entry];
+                if(Path.Moves < 0){ continue; }
+                for(uint8_t Exit = 0; Exit < NUMBER_OF_TILES; Exit++){
+                    const PathCost_t &Step = Costs[Entry * NUMBER_OF_TILES + Exit];
+                    if(Step.Moves == UNREACHABLE){ continue; }
+                    LineCost_t &Next = NextPaths[Exit];
+                    if(Next.Moves < 0 || Path.Moves + Step.Moves < Next.Moves){
+                        Next = {Path.Moves + Step.Moves, Path.GroupMoves + Step.GroupMoves, Path.TileMoves + Step.TileMoves,
+                                Path.ShiftPresses + Step.ShiftPresses, Path.ButtonPresses + Step.ButtonPresses,
+                                Path.Suggestions + Step.Suggestions};
+                    }
+                }
+            }
+            Paths = NextPaths;
+        }
+
+        int BestGroup = -1;
+        for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+            if(Paths[Group].Moves >= 0 && (BestGroup < 0 || Paths[Group].Moves < Paths[BestGroup].Moves)){
+                BestGroup = Group;
+            }
+        }
+        if(BestGroup < 0){ // The candidate has no button typing the spaces
+            _Counts.SkippedCharacters += Target.length() + 1;
+            continue;
+        }
+
+        const LineCost_t &Best = Paths[BestGroup];
+        _Counts.GroupMoves += Best.GroupMoves;
+        _Counts.TileMoves += Best.TileMoves;
+        _Counts.ShiftPresses += Best.ShiftPresses;
+        _Counts.ButtonPresses += Best.ButtonPresses;
+        _Counts.AcceptedSuggestions += Best.Suggestions;
+        _CurrentGroup = BestGroup;
+    }
+}
+
+LayoutCandidate_t ShippedCandidate(void){
+    LayoutCandidate_t Candidate = {{{}, {}}, {}, {}};
+    for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+        for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+            CharGroup_t Chars;
+            for(uint8_t Tile = 0; Tile < NUMBER_OF_TILES - GroupsSuggestionsMap[Group]; Tile++){
+                const std::string_view &Text = InnerTilesChars[Shift][Group][Tile];
+                Chars.append(QString::fromUtf8(Text.data(), static_cast<int>(Text.size())));
+            }
+            Candidate.Tiles[Shift].append(Chars);
+        }
+        Candidate.SuggestionsMap.append(GroupsSuggestionsMap[Group]);
+    }
+    for(const PhysicalButton_t *Button : ShippedButtons){
+        Candidate.Buttons.append(*Button);
+    }
+    return Candidate;
+}
+
+LayoutCandidate_t CandidateWithLetters(const LayoutCandidate_t &Base, const LetterLayout_t &Letters){
+    LayoutCandidate_t Candidate = Base;
+    for(int Group = 0; Group < static_cast<int>(Letters.size()) && Group < Candidate.Tiles[NOT_SHIFTED].length(); Group++){
+        CharGroup_t Lower;
+        CharGroup_t Upper;
+        for(const char Letter : Letters[Group]){
+            Lower.append(QString(QChar::fromLatin1(Letter)));
+            Upper.append(Lower.last().toUpper());
+        }
+        Candidate.Tiles[NOT_SHIFTED][Group] = Lower;
+        Candidate.Tiles[SHIFTED][Group] = Upper;
+        // As in the shipped layout: the tiles left by the letters are suggestion tiles
+        Candidate.SuggestionsMap[Group] = static_cast<uint8_t>(qMax(static_cast<int>(NUMBER_OF_TILES) - Lower.length(), 0));
+    }
+    return Candidate;
+}
+
+LayoutEvaluator::LayoutEvaluator(const QSharedPointer<const Trie> &Dictionary, const bool UseSuggestions)
+    : _Dictionary(Dictionary)
+    , _UseSuggestions(UseSuggestions)
+{
+}
+
+QVector<MoveCounts_t> LayoutEvaluator::Evaluate(QTextStream &Corpus, const QVector<LayoutCandidate_t> &Candidates, const int MaxLines) const{
+    QVector<CandidateReplay*> Replays;
+    for(const LayoutCandidate_t &Candidate : Candidates){
+        Replays.append(new CandidateReplay(Candidate, _Dictionary, _UseSuggestions));
+    }
+
+    QStringList Chunk;
+    int LinesRead = 0;
+    while(!Corpus.atEnd() && (MaxLines == 0 || LinesRead < MaxLines)){
+        Chunk.clear();
+        while(!Corpus.atEnd() && Chunk.length() < EVALUATOR_CHUNK_LINES && (MaxLines == 0 || LinesRead < MaxLines)){
+            Chunk.append(Corpus.readLine());
+            LinesRead++;
+        }
+        // Each candidate only touches its own state: no locking, and the same counts whatever the scheduling
+        QtConcurrent::blockingMap(Replays, [&Chunk](CandidateReplay *Replay){ Replay->ReplayLines(Chunk); });
+    }
+
+    QVector<MoveCounts_t> Counts;
+    for(const CandidateReplay *Replay : Replays){
+        Counts.append(Replay->GetCounts());
+    }
+    qDeleteAll(Replays);
+    return Counts;
+}
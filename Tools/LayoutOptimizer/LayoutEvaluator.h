@@ -0,0 +1,121 @@
+/* LayoutEvaluator.h */
+
+#ifndef LAYOUTEVALUATOR_H
+#define LAYOUTEVALUATOR_H
+
+#include <QSharedPointer>
+#include <QTextStream>
+#include <QVector>
+
+#include "Headers/GP4k_ButtonsMapping.h"
+#include "Headers/GP4k_TilesMapping.h"
+#include "Headers/Trie.h"
+
+#include "LayoutProblem.h"
+
+/**
+ * @def EVALUATOR_CHUNK_LINES
+ * @brief Lines of the corpus read at once, then replayed against every candidate in parallel.
+ */
+#define EVALUATOR_CHUNK_LINES 4096
+
+/**
+ * @def EVALUATOR_CACHE_TOKENS
+ * @brief Words whose costs are kept by each candidate, the least recently used being evicted first.
+ *
+ * @details The words of a corpus follow a Zipf law: a few thousands of them make most of the text, and their costs
+ * are computed once instead of at each occurrence.
+ */
+#define EVALUATOR_CACHE_TOKENS 16384
+
+/**
+ * @brief A mapping of the characters to replay the corpus against.
+ */
+struct LayoutCandidate_t {
+    QVector<QVector<CharGroup_t>> Tiles; /**< The chars of the inner tiles, [ShiftState_t][Group], as InnerTilesChars. */
+    QVector<uint8_t> SuggestionsMap;     /**< The suggestion tiles of each group, as GroupsSuggestionsMap. */
+    QVector<PhysicalButton_t> Buttons;   /**< The buttons and their features, as in GP4k_ButtonsMapping.h. */
+};
+
+/**
+ * @brief The moves needed to type a corpus with a candidate.
+ */
+struct MoveCounts_t {
+    qint64 Characters;          /**< Characters typed, spaces included. */
+    qint64 Words;               /**< Words of the corpus. */
+    qint64 SkippedCharacters;   /**< Characters of the corpus the candidate can't type. */
+    qint64 GroupMoves;          /**< Moves of the left stick. */
+    qint64 TileMoves;           /**< Moves of the right stick, suggestions included. */
+    qint64 ShiftPresses;        /**< Presses on the shift button. */
+    qint64 ButtonPresses;       /**< Presses on the other buttons: space, punctuation, backspace. */
+    qint64 AcceptedSuggestions; /**< Words completed with a suggestion tile. */
+
+    /**
+     * @brief The total of the moves and presses.
+     * @return The number of actions of the user.
+     */
+    qint64 Moves(void) const { return GroupMoves + TileMoves + ShiftPresses + ButtonPresses; }
+};
+
+/**
+ * @brief Builds the candidate of the shipped mapping.
+ * @return The tables of GP4k_TilesMapping.h and GP4k_ButtonsMapping.h.
+ */
+LayoutCandidate_t ShippedCandidate(void);
+
+/**
+ * @brief Builds a candidate moving the letters of another one.
+ * @param Base The candidate to start from.
+ * @param Letters The letters of the first groups, such as an optimizer output. The following groups keep their chars.
+ * @return The candidate, with the lower case letters NOT_SHIFTED and the upper case ones SHIFTED, and the tiles of
+ * each group left by its letters as suggestion tiles.
+ */
+LayoutCandidate_t CandidateWithLetters(const LayoutCandidate_t &Base, const LetterLayout_t &Letters);
+
+/**
+ * @brief The LayoutEvaluator class counts the moves needed to type a corpus with candidate mappings.
+ *
+ * @details The user is modelled as the planner of gp4k-simulator, with each action costing one move: for each line,
+ * the cheapest sequence of group moves, tile moves, shift presses, buttons and suggestion tiles is chosen. A
+ * punctuation types its following space, and a backspace erases it when the corpus has none; a suggestion types the
+ * end of the word and a space.
+ *
+ * The spaces never change the selected group, so a line is split on them into words, and the cost of a word is an
+ * 8 x 8 matrix from the group selected when it starts to the group selected when it ends. Lines are then chained
+ * with (min, +) products of these matrices. Each candidate caches the matrices of the frequent words, which turns
+ * the replay of a corpus into a few hash lookups per word.
+ *
+ * The corpus is read once, by chunks of EVALUATOR_CHUNK_LINES lines: each chunk is replayed against all the
+ * candidates in parallel, so the memory doesn't depend on the size of the corpus.
+ */
+class LayoutEvaluator {
+public: // Methods
+    /**
+     * @brief Constructor of the LayoutEvaluator.
+     * @param Dictionary The dictionary offering the suggestions.
+     * @param UseSuggestions False to model a user ignoring the suggestion tiles.
+     */
+    LayoutEvaluator(const QSharedPointer<const Trie> &Dictionary, const bool UseSuggestions);
+
+    /**
+     * @brief Replays a corpus against candidates.
+     * @param Corpus The text to type, read line by line until its end.
+     * @param Candidates The mappings to evaluate.
+     * @param MaxLines Stop after this number of lines, 0 to read the whole corpus.
+     * @return The moves of each candidate, in the order of Candidates.
+     */
+    QVector<MoveCounts_t> Evaluate(QTextStream &Corpus, const QVector<LayoutCandidate_t> &Candidates, const int MaxLines = 0) const;
+
+private: // Attributes
+    /**
+     * @brief The dictionary offering the suggestions.
+     */
+    QSharedPointer<const Trie> _Dictionary;
+
+    /**
+     * @brief False to model a user ignoring the suggestion tiles.
+     */
+    bool _UseSuggestions;
+};
+
+#endif // LAYOUTEVALUATOR_H
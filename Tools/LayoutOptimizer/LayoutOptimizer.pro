@@ -0,0 +1,31 @@
+# Letters layout optimizer: solves the QAP of the letters placement with a
+# multi-start tabu search, spread over all the cores, then re-ranks the best
+# layouts by the moves needed to type a corpus. With --extended, also places the
+# D-pad punctuation and the suggestion tiles from trigram counts. With --personal,
+# places the letters for the counts of GP4k --stats, and writes them to a layout
+# file with --apply.
+
+QT -= gui
+QT += core concurrent
+
+CONFIG += c++17 console thread
+CONFIG -= app_bundle
+
+TARGET = gp4k-layout-optimizer
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    ExtendedProblem.cpp \
+    ExtendedSolver.cpp \
+    LayoutEvaluator.cpp \
+    LayoutProblem.cpp \
+    QapSolver.cpp \
+    main.cpp
+
+HEADERS += \
+    ExtendedProblem.h \
+    ExtendedSolver.h \
+    LayoutEvaluator.h \
+    LayoutProblem.h \
+    QapSolver.h
@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "LayoutProblem.h"
+
+/**
+ * @brief The index of a letter in LAYOUT_ALPHABET.
+ * @param Letter The letter, in any case.
+ * @return The index, -1 if the character is not a letter of LAYOUT_ALPHABET.
+ */
+static int LetterIndex(const char Letter){
+    static const std::string Alphabet = LAYOUT_ALPHABET;
+    const std::string::size_type Index = Alphabet.find(static_cast<char>(std::tolower(static_cast<unsigned char>(Letter))));
+    return (Index == std::string::npos) ? -1 : static_cast<int>(Index);
+}
+
+/**
+ * @brief Reads the count ending a line, after its tab.
+ * @param Line The line, the count being its last field.
+ * @param Start The index of the first character of the count.
+ * @param Count Receives the count.
+ * @return False if the field is not a non-negative integer, trailing spaces apart.
+ */
+static bool ParseCount(const std::string &Line, const std::string::size_type Start, int64_t &Count){
+    const char *First = Line.data() + Start;
+    const char *Last = Line.data() + Line.size();
+    while(Last > First && std::isspace(static_cast<unsigned char>(Last[-1]))){ // Such as the \r of a Windows file
+        Last--;
+    }
+    const std::from_chars_result Result = std::from_chars(First, Last, Count);
+    return Result.ec == std::errc() && Result.ptr == Last && First != Last && Count >= 0;
+}
+
+bool LoadBigramFlow(const std::string &Path, std::vector<int64_t> &Flow, std::vector<int> *BadLines){
+    std::ifstream File(Path);
+    if(!File){
+        return false;
+    }
+
+    const int Size = sizeof(LAYOUT_ALPHABET) - 1;
+    Flow.assign(Size * Size, 0);
+
+    std::string Line;
+    int LineNumber = 0;
+    while(std::getline(File, Line)){
+        LineNumber++;
+        const std::string::size_type Tab = Line.find('\t');
+        if(Tab != 2){ // Not a bigram
+            continue;
+        }
+        const int First = LetterIndex(Line[0]);
+        const int Second = LetterIndex(Line[1]);
+        // The directionality of the bigrams doesn't matter, and doubled letters never change the group
+        if(First < 0 || Second < 0 || First == Second){
+            continue;
+        }
+        int64_t Count = 0;
+        if(!ParseCount(Line, Tab + 1, Count)){
+            if(BadLines != nullptr){
+                BadLines->push_back(LineNumber);
+            }
+            continue;
+        }
+        Flow[First * Size + Second] += Count;
+        Flow[Second * Size + First] += Count;
+    }
+    return true;
+}
+
+bool LoadLetterCounts(const std::string &Path, std::vector<int64_t> &Counts, std::vector<int> *BadLines){
+    std::ifstream File(Path);
+    if(!File){
+        return false;
+    }
+
+    Counts.assign(sizeof(LAYOUT_ALPHABET) - 1, 0);
+    std::string Line;
+    int LineNumber = 0;
+    while(std::getline(File, Line)){
+        LineNumber++;
+        const std::string::size_type Tab = Line.find('\t');
+        if(Tab != 1){ // Not a letter
+            continue;
+        }
+        const int Letter = LetterIndex(Line[0]);
+        if(Letter < 0){
+            continue;
+        }
+        int64_t Count = 0;
+        if(!ParseCount(Line, Tab + 1, Count)){
+            if(BadLines != nullptr){
+                BadLines->push_back(LineNumber);
+            }
+            continue;
+        }
+        Counts[Letter] += Count;
+    }
+    return true;
+}
+
+QapProblem_t MakeLayoutProblem(const std::vector<int> &GroupSizes, const std::vector<int64_t> &Flow){
+    QapProblem_t Problem;
+    Problem.Size = std::accumulate(GroupSizes.begin(), GroupSizes.end(), 0);
+    Problem.Flow = Flow;
+
+    std::vector<int> GroupOfTile;
+    for(int Group = 0; Group < static_cast<int>(GroupSizes.size()); Group++){
+        GroupOfTile.insert(GroupOfTile.end(), GroupSizes[Group], Group);
+    }
+
+    Problem.Distance.resize(Problem.Size * Problem.Size);
+    for(int I = 0; I < Problem.Size; I++){
+        for(int J = 0; J < Problem.Size; J++){
+            Problem.Distance[I * Problem.Size + J] = (GroupOfTile[I] == GroupOfTile[J]) ? LAYOUT_INTRA_GROUP_DISTANCE
+                                                                                        : LAYOUT_INTER_GROUP_DISTANCE;
+        }
+    }
+    return Problem;
+}
+
+bool ParseLayout(const std::string &Text, LetterLayout_t &Layout){
+    Layout.clear();
+    std::vector<bool> Seen(sizeof(LAYOUT_ALPHABET) - 1, false);
+    std::istringstream Stream(Text);
+    std::string Group;
+    while(Stream >> Group){
+        for(char &Letter : Group){
+            const int Index = LetterIndex(Letter);
+            if(Index < 0 || Seen[Index]){
+                return false;
+            }
+            Seen[Index] = true;
+            Letter = LAYOUT_ALPHABET[Index];
+        }
+        Layout.push_back(Group);
+    }
+    return std::all_of(Seen.begin(), Seen.end(), [](const bool LetterSeen){ return LetterSeen; });
+}
+
+std::vector<int> LayoutToAssignment(const LetterLayout_t &Layout){
+    std::vector<int> Assignment;
+    for(const std::string &Group : Layout){
+        for(const char Letter : Group){
+            Assignment.push_back(LetterIndex(Letter));
+        }
+    }
+    return Assignment;
+}
+
+LetterLayout_t AssignmentToLayout(const std::vector<int> &Assignment, const std::vector<int> &GroupSizes,
+                                  const std::vector<int64_t> &Flow){
+    const int Size = static_cast<int>(Assignment.size());
+    std::vector<int64_t> LetterFlow(Size, 0);
+    for(int Letter = 0; Letter < Size; Letter++){
+        LetterFlow[Letter] = std::accumulate(Flow.begin() + Letter * Size, Flow.begin() + (Letter + 1) * Size, int64_t(0));
+    }
+
+    struct Group_t {
+        std::vector<int> Letters;
+        int64_t TotalFlow;
+    };
+    std::vector<Group_t> Groups;
+    int Tile = 0;
+    for(const int GroupSize : GroupSizes){
+        Group_t Group = {std::vector<int>(Assignment.begin() + Tile, Assignment.begin() + Tile + GroupSize), 0};
+        std::sort(Group.Letters.begin(), Group.Letters.end(),
+                  [&LetterFlow](const int A, const int B){ return LetterFlow[A] > LetterFlow[B]; });
+        for(const int Letter : Group.Letters){
+            Group.TotalFlow += LetterFlow[Letter];
+        }
+        Groups.push_back(Group);
+        Tile += GroupSize;
+    }
+
+    // Stable, and only within the runs of groups of the same size: the sizes stay where the caller expects them
+    for(std::vector<Group_t>::iterator First = Groups.begin(); First != Groups.end();){
+        std::vector<Group_t>::iterator Last = First;
+        while(Last != Groups.end() && Last->Letters.size() == First->Letters.size()){
+            ++Last;
+        }
+        std::stable_sort(First, Last, [](const Group_t &A, const Group_t &B){ return A.TotalFlow > B.TotalFlow; });
+        First = Last;
+    }
+
+    LetterLayout_t Layout;
+    for(const Group_t &Group : Groups){
+        std::string Letters;
+        for(const int Letter : Group.Letters){
+            Letters += LAYOUT_ALPHABET[Letter];
+        }
+        Layout.push_back(Letters);
+    }
+    return Layout;
+}
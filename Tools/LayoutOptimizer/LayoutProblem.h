@@ -0,0 +1,89 @@
+/* LayoutProblem.h */
+
+#ifndef LAYOUTPROBLEM_H
+#define LAYOUTPROBLEM_H
+
+#include <string>
+#include <vector>
+
+#include "QapSolver.h"
+
+/**
+ * @def LAYOUT_ALPHABET
+ * @brief The letters placed by the optimizer: the items of the QAP, in this order.
+ */
+#define LAYOUT_ALPHABET "abcdefghijklmnopqrstuvwxyz"
+
+/**
+ * @def LAYOUT_INTRA_GROUP_DISTANCE
+ * @brief Moves between two letters of the same char group: the right stick only.
+ */
+#define LAYOUT_INTRA_GROUP_DISTANCE 1
+
+/**
+ * @def LAYOUT_INTER_GROUP_DISTANCE
+ * @brief Moves between two letters of different char groups: the left stick, then the right one.
+ */
+#define LAYOUT_INTER_GROUP_DISTANCE 2
+
+/**
+ * @brief A layout of the letters: the letters of each char group, in tile order.
+ */
+typedef std::vector<std::string> LetterLayout_t;
+
+/**
+ * @brief Builds the symmetric flow matrix of the letters from a bigrams count file.
+ * @param Path A file holding, on each line, a bigram and its count separated by a tab (such as count_2l.txt).
+ * @param Flow Receives the LAYOUT_ALPHABET² matrix: the counts of "ab" and "ba" summed, with a null diagonal.
+ * @param BadLines Receives the numbers, from 1, of the bigram lines skipped as their count is unreadable (optional).
+ * @return False if the file can't be read.
+ */
+bool LoadBigramFlow(const std::string &Path, std::vector<int64_t> &Flow, std::vector<int> *BadLines = nullptr);
+
+/**
+ * @brief Reads the letter counts of a file in the count_2l.txt format, such as the one of GP4k --stats.
+ * @param Path A file holding, on each line, a letter or a bigram and its count separated by a tab.
+ * @param Counts Receives the count of each letter of LAYOUT_ALPHABET; the bigrams are ignored.
+ * @param BadLines Receives the numbers, from 1, of the letter lines skipped as their count is unreadable (optional).
+ * @return False if the file can't be read.
+ */
+bool LoadLetterCounts(const std::string &Path, std::vector<int64_t> &Counts, std::vector<int> *BadLines = nullptr);
+
+/**
+ * @brief Builds the QAP of the letters layout.
+ * @param GroupSizes The number of tiles of each char group; they must sum to the size of LAYOUT_ALPHABET.
+ * @param Flow The flow matrix, as built by LoadBigramFlow.
+ * @return The problem, the locations being the tiles of the groups one after the other.
+ */
+QapProblem_t MakeLayoutProblem(const std::vector<int> &GroupSizes, const std::vector<int64_t> &Flow);
+
+/**
+ * @brief Parses a layout written as space separated groups, such as "trshea qflkb zgvxj ocind pumwy".
+ * @param Text The layout to parse.
+ * @param Layout Receives the groups.
+ * @return False if the layout doesn't hold each letter of LAYOUT_ALPHABET exactly once.
+ */
+bool ParseLayout(const std::string &Text, LetterLayout_t &Layout);
+
+/**
+ * @brief Converts a layout to an assignment of the layout problem.
+ * @param Layout A valid layout.
+ * @return The assignment: the index, in LAYOUT_ALPHABET, of the letter on each tile.
+ */
+std::vector<int> LayoutToAssignment(const LetterLayout_t &Layout);
+
+/**
+ * @brief Converts an assignment of the layout problem to a layout, in a canonical form.
+ *
+ * @details The cost doesn't depend on the order of the tiles within a group, nor on the order of the groups of the
+ * same size. The letters of a group are thus sorted by decreasing flow, and the groups of the same size by decreasing
+ * total flow, so that two runs finding the same layout print it the same way.
+ * @param Assignment An assignment of the layout problem.
+ * @param GroupSizes The number of tiles of each char group.
+ * @param Flow The flow matrix of the problem.
+ * @return The layout.
+ */
+LetterLayout_t AssignmentToLayout(const std::vector<int> &Assignment, const std::vector<int> &GroupSizes,
+                                  const std::vector<int64_t> &Flow);
+
+#endif // LAYOUTPROBLEM_H
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "QapSolver.h"
+
+QapSolver::QapSolver(const QapProblem_t &Problem)
+    : _Problem(Problem)
+{
+    for(int R = 0; R < _Problem.Size; R++){
+        for(int S = R + 1; S < _Problem.Size; S++){
+            if(!AreEquivalent(R, S)){
+                _Swaps.emplace_back(R, S);
+            }
+        }
+    }
+}
+
+bool QapSolver::AreEquivalent(const int R, const int S) const{
+    if(D(R, R) != D(S, S) || D(R, S) != D(S, R)){
+        return false;
+    }
+    for(int K = 0; K < _Problem.Size; K++){
+        if(K != R && K != S && (D(R, K) != D(S, K) || D(K, R) != D(K, S))){
+            return false;
+        }
+    }
+    return true;
+}
+
+int64_t QapSolver::Cost(const std::vector<int> &Assignment) const{
+    int64_t Total = 0;
+    for(int I = 0; I < _Problem.Size; I++){
+        for(int J = 0; J < _Problem.Size; J++){
+            Total += D(I, J) * F(Assignment[I], Assignment[J]);
+        }
+    }
+    return Total;
+}
+
+int64_t QapSolver::SwapDelta(const std::vector<int> &Assignment, const int R, const int S) const{
+    const std::vector<int> &P = Assignment;
+    int64_t Delta = (D(R, R) - D(S, S)) * (F(P[S], P[S]) - F(P[R], P[R]))
+                  + (D(R, S) - D(S, R)) * (F(P[S], P[R]) - F(P[R], P[S]));
+    for(int K = 0; K < _Problem.Size; K++){
+        if(K != R && K != S){
+            Delta += (D(K, R) - D(K, S)) * (F(P[K], P[S]) - F(P[K], P[R]))
+                   + (D(R, K) - D(S, K)) * (F(P[S], P[K]) - F(P[R], P[K]));
+        }
+    }
+    return Delta;
+}
+
+int64_t QapSolver::UpdatedSwapDelta(const std::vector<int> &Assignment, const int64_t Delta,
+                                    const int I, const int J, const int R, const int S) const{
+    const std::vector<int> &P = Assignment;
+    return Delta
+         + (D(R, I) - D(R, J) + D(S, J) - D(S, I)) * (F(P[S], P[I]) - F(P[S], P[J]) + F(P[R], P[J]) - F(P[R], P[I]))
+         + (D(I, R) - D(J, R) + D(J, S) - D(I, S)) * (F(P[I], P[S]) - F(P[J], P[S]) + F(P[J], P[R]) - F(P[I], P[R]));
+}
+
+QapSolution_t QapSolver::RunTabuSearch(const uint64_t Seed, const int64_t Iterations, int64_t &EvaluatedSwaps) const{
+    const int N = _Problem.Size;
+    std::mt19937_64 Generator(Seed);
+
+    std::vector<int> Current(N);
+    std::iota(Current.begin(), Current.end(), 0);
+    std::shuffle(Current.begin(), Current.end(), Generator);
+    int64_t CurrentCost = Cost(Current);
+
+    QapSolution_t Best = {Current, CurrentCost, 0};
+    if(_Swaps.empty()){ // Every assignment costs the same
+        return Best;
+    }
+
+    // Delta[R * N + S], R < S: cost variation of swapping the locations R and S
+    std::vector<int64_t> Delta(N * N, 0);
+    for(const std::pair<int, int> &Swap : _Swaps){
+        Delta[Swap.first * N + Swap.second] = SwapDelta(Current, Swap.first, Swap.second);
+    }
+    EvaluatedSwaps += _Swaps.size();
+
+    // Tabu[Location * N + Item]: last iteration at which placing Item back at Location is forbidden
+    std::vector<int64_t> Tabu(N * N);
+    for(int Location = 0; Location < N; Location++){
+        for(int Item = 0; Item < N; Item++){
+            Tabu[Location * N + Item] = -(static_cast<int64_t>(N) * Location + Item);
+        }
+    }
+
+    const int TenureMin = std::max(1, N * TABU_TENURE_MIN / 100);
+    const int TenureMax = std::max(TenureMin, N * TABU_TENURE_MAX / 100);
+    std::uniform_int_distribution<int> TenureDistribution(TenureMin, TenureMax);
+    int Tenure = TenureDistribution(Generator);
+    const int64_t Aspiration = static_cast<int64_t>(TABU_ASPIRATION) * N * N;
+
+    for(int64_t Iteration = 1; Iteration <= Iterations; Iteration++){
+        int RetainedR = -1;
+        int RetainedS = -1;
+        int64_t MinDelta = std::numeric_limits<int64_t>::max();
+        bool AlreadyAspired = false;
+
+        for(const std::pair<int, int> &Swap : _Swaps){
+            const int R = Swap.first;
+            const int S = Swap.second;
+            const int64_t SwapTabuR = Tabu[R * N + Current[S]];
+            const int64_t SwapTabuS = Tabu[S * N + Current[R]];
+            const int64_t SwapDelta = Delta[R * N + S];
+            const bool Authorized = SwapTabuR < Iteration || SwapTabuS < Iteration;
+            const bool Aspired = SwapTabuR < Iteration - Aspiration || SwapTabuS < Iteration - Aspiration
+                              || CurrentCost + SwapDelta < Best.Cost;
+
+            if((Aspired && !AlreadyAspired)
+               || (Aspired && AlreadyAspired && SwapDelta < MinDelta)
+               || (!Aspired && !AlreadyAspired && Authorized && SwapDelta < MinDelta)){
+                RetainedR = R;
+                RetainedS = S;
+                MinDelta = SwapDelta;
+                AlreadyAspired = AlreadyAspired || Aspired;
+            }
+        }
+
+        if(RetainedR < 0){ // Every move is tabu: wait for the tenures to expire
+            continue;
+        }
+
+        std::swap(Current[RetainedR], Current[RetainedS]);
+        CurrentCost += Delta[RetainedR * N + RetainedS];
+        Tabu[RetainedR * N + Current[RetainedS]] = Iteration + Tenure;
+        Tabu[RetainedS * N + Current[RetainedR]] = Iteration + Tenure;
+
+        if(CurrentCost < Best.Cost){
+            Best.Assignment = Current;
+            Best.Cost = CurrentCost;
+        }
+
+        for(const std::pair<int, int> &Swap : _Swaps){
+            const int I = Swap.first;
+            const int J = Swap.second;
+            if(I != RetainedR && I != RetainedS && J != RetainedR && J != RetainedS){
+                Delta[I * N + J] = UpdatedSwapDelta(Current, Delta[I * N + J], I, J, RetainedR, RetainedS);
+            }
+            else{
+                Delta[I * N + J] = SwapDelta(Current, I, J);
+            }
+        }
+        EvaluatedSwaps += _Swaps.size();
+
+        if(Iteration % (2 * TenureMax) == 0){
+            Tenure = TenureDistribution(Generator);
+        }
+    }
+    return Best;
+}
+
+TabuReport_t QapSolver::Solve(const TabuSettings_t &Settings) const{
+    return RunStarts(Settings, [this, &Settings](const uint64_t Seed, int64_t &EvaluatedSwaps){
+        return RunTabuSearch(Seed, Settings.Iterations, EvaluatedSwaps);
+    });
+}
+
+TabuReport_t RunStarts(const TabuSettings_t &Settings, const std::function<QapSolution_t(uint64_t, int64_t&)> &Search){
+    const int Starts = std::max(Settings.Starts, 1);
+    int Threads = (Settings.Threads > 0) ? Settings.Threads : static_cast<int>(std::thread::hardware_concurrency());
+    Threads = std::clamp(Threads, 1, Starts);
+
+    std::vector<QapSolution_t> Solutions(Starts);
+    std::vector<int64_t> EvaluatedSwaps(Threads, 0);
+    std::atomic<int> NextStart(0);
+
+    std::vector<std::thread> Workers;
+    for(int Worker = 0; Worker < Threads; Worker++){
+        Workers.emplace_back([&Settings, &Search, &Solutions, &EvaluatedSwaps, &NextStart, Starts, Worker](){
+            for(int Start = NextStart++; Start < Starts; Start = NextStart++){
+                Solutions[Start] = Search(Settings.Seed + Start, EvaluatedSwaps[Worker]);
+                Solutions[Start].Start = Start;
+            }
+        });
+    }
+    for(std::thread &Worker : Workers){
+        Worker.join();
+    }
+
+    TabuReport_t Report = {Solutions[0], 0, 0, {}};
+    for(const QapSolution_t &Solution : Solutions){
+        if(Solution.Cost < Report.Best.Cost){ // Strict: the lowest start index wins ties
+            Report.Best = Solution;
+        }
+    }
+    for(const QapSolution_t &Solution : Solutions){
+        Report.BestHits += (Solution.Cost == Report.Best.Cost) ? 1 : 0;
+    }
+    Report.EvaluatedSwaps = std::accumulate(EvaluatedSwaps.begin(), EvaluatedSwaps.end(), int64_t(0));
+    std::stable_sort(Solutions.begin(), Solutions.end(),
+                     [](const QapSolution_t &A, const QapSolution_t &B){ return A.Cost < B.Cost; });
+    Report.Solutions = Solutions;
+    return Report;
+}
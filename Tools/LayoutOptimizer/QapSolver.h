@@ -0,0 +1,170 @@
+/* QapSolver.h */
+
+#ifndef QAPSOLVER_H
+#define QAPSOLVER_H
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @def TABU_TENURE_MIN
+ * @brief Lower bound of the tabu tenure, in percents of the problem size.
+ */
+#define TABU_TENURE_MIN 90
+
+/**
+ * @def TABU_TENURE_MAX
+ * @brief Upper bound of the tabu tenure, in percents of the problem size.
+ *
+ * @details The tenure is drawn again every 2 * TABU_TENURE_MAX iterations, which prevents the search from cycling
+ * with a fixed tenure.
+ */
+#define TABU_TENURE_MAX 110
+
+/**
+ * @def TABU_ASPIRATION
+ * @brief A move not performed since TABU_ASPIRATION * n² iterations is forced, to diversify the search.
+ */
+#define TABU_ASPIRATION 5
+
+/**
+ * @brief Describes a Quadratic Assignment Problem: placing Size items on Size locations.
+ *
+ * @details The cost of an assignment P (P[Location] is the item placed at Location) is the sum over all the pairs of
+ * locations of Distance[i][j] * Flow[P[i]][P[j]]. Both matrices are stored row-major. For the keyboard layout, the
+ * locations are the tiles and the items are the letters.
+ */
+struct QapProblem_t {
+    int Size;                     /**< The number of locations, and of items. */
+    std::vector<int64_t> Distance; /**< Size x Size, indexed by locations. */
+    std::vector<int64_t> Flow;     /**< Size x Size, indexed by items. */
+};
+
+/**
+ * @brief An assignment and its cost.
+ */
+struct QapSolution_t {
+    std::vector<int> Assignment; /**< Assignment[Location] is the item placed at Location. */
+    int64_t Cost;                /**< The cost of the assignment. */
+    int Start;                   /**< The index of the start which found it. */
+};
+
+/**
+ * @brief The parameters of a multi-start tabu search.
+ */
+struct TabuSettings_t {
+    int Starts;          /**< Independent searches, each from a random assignment. */
+    int64_t Iterations;  /**< Swaps performed by each search. */
+    uint64_t Seed;       /**< Seed of the first start; start N is seeded with Seed + N. */
+    int Threads;         /**< Threads sharing the starts, 0 for one per core. */
+};
+
+/**
+ * @brief Holds the outcome of a multi-start tabu search.
+ */
+struct TabuReport_t {
+    QapSolution_t Best;     /**< The best assignment over all the starts. */
+    int BestHits;           /**< Starts that reached the best cost. */
+    int64_t EvaluatedSwaps; /**< Swap deltas computed over all the starts. */
+    std::vector<QapSolution_t> Solutions; /**< The best assignment of each start, by increasing cost. */
+};
+
+/**
+ * @brief The QapSolver class solves a QAP with Taillard's robust tabu search.
+ *
+ * @details Each iteration performs the best swap of two locations that is not tabu. The cost variation of every
+ * possible swap is kept in a delta table: after a swap of r and s, the deltas of the pairs disjoint of {r, s} are
+ * updated in O(1), and only the ones involving r or s are recomputed in O(n). An iteration is thus O(n²) instead of
+ * the O(n⁴) of a full evaluation of each neighbour.
+ *
+ * Swapping two equivalent locations (same distances to every other location) never changes the cost: these swaps,
+ * such as two tiles of the same char group, are never considered, so the search doesn't wander on the plateaus.
+ *
+ * The starts are independent and their seeds only depend on their index: the result is the same whatever the number
+ * of threads sharing them.
+ */
+class QapSolver {
+public: // Methods
+    /**
+     * @brief Constructor of the QapSolver.
+     * @param Problem The problem to solve.
+     */
+    explicit QapSolver(const QapProblem_t &Problem);
+
+    /**
+     * @brief Runs the starts of a multi-start tabu search, spread over several threads.
+     * @param Settings The parameters of the search.
+     * @return The best assignment found, the lowest start index winning ties.
+     */
+    TabuReport_t Solve(const TabuSettings_t &Settings) const;
+
+    /**
+     * @brief Runs a single tabu search from a random assignment.
+     * @param Seed The seed of the random assignment and of the tabu tenures.
+     * @param Iterations The swaps to perform.
+     * @param EvaluatedSwaps Incremented by the number of swap deltas computed.
+     * @return The best assignment met during the search.
+     */
+    QapSolution_t RunTabuSearch(const uint64_t Seed, const int64_t Iterations, int64_t &EvaluatedSwaps) const;
+
+    /**
+     * @brief Computes the cost of an assignment from scratch.
+     * @param Assignment The assignment to evaluate.
+     * @return The cost of the assignment.
+     */
+    int64_t Cost(const std::vector<int> &Assignment) const;
+
+private: // Methods
+    /**
+     * @brief Computes the cost variation of swapping the items of two locations, in O(n).
+     * @param Assignment The current assignment.
+     * @param R The first location.
+     * @param S The second location.
+     * @return The cost after the swap minus the cost before.
+     */
+    int64_t SwapDelta(const std::vector<int> &Assignment, const int R, const int S) const;
+
+    /**
+     * @brief Updates, in O(1), the delta of the swap (I, J) after the locations R and S were swapped.
+     * @param Assignment The assignment, R and S already swapped.
+     * @param Delta The delta of (I, J) before the swap of R and S.
+     * @return The delta of (I, J) after the swap of R and S.
+     * @warning I and J must both differ from R and S.
+     */
+    int64_t UpdatedSwapDelta(const std::vector<int> &Assignment, const int64_t Delta,
+                             const int I, const int J, const int R, const int S) const;
+
+    /**
+     * @brief Tells if swapping the items of two locations can never change the cost.
+     * @param R The first location.
+     * @param S The second location.
+     * @return True if R and S have the same distances to every location.
+     */
+    bool AreEquivalent(const int R, const int S) const;
+
+    inline int64_t D(const int I, const int J) const { return _Problem.Distance[I * _Problem.Size + J]; }
+    inline int64_t F(const int I, const int J) const { return _Problem.Flow[I * _Problem.Size + J]; }
+
+private: // Attributes
+    /**
+     * @brief The problem to solve.
+     */
+    QapProblem_t _Problem;
+
+    /**
+     * @brief The swaps worth considering, as (R, S) pairs with R < S: the pairs of non-equivalent locations.
+     */
+    std::vector<std::pair<int, int>> _Swaps;
+};
+
+/**
+ * @brief Runs the starts of a multi-start search, spread over several threads.
+ * @param Settings The parameters of the search.
+ * @param Search Runs one start from its seed, incrementing its second argument by the swap deltas it computed.
+ * @return The best assignment found, the lowest start index winning ties.
+ */
+TabuReport_t RunStarts(const TabuSettings_t &Settings, const std::function<QapSolution_t(uint64_t, int64_t&)> &Search);
+
+#endif // QAPSOLVER_H
@@ -0,0 +1,511 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTextStream>
+
+#include "Headers/KeyboardLayout.h"
+#include "ExtendedProblem.h"
+#include "ExtendedSolver.h"
+#include "LayoutEvaluator.h"
+#include "LayoutProblem.h"
+#include "QapSolver.h"
+
+/**
+ * @def SHIPPED_LAYOUT
+ * @brief The letters of the first five groups of InnerTilesChars, the reference the optimizer is compared to.
+ */
+#define SHIPPED_LAYOUT "trshea qflkb zgvxj ocind pumwy"
+
+/**
+ * @def PERSONAL_FLOW_SCALE
+ * @brief The total of the blended flow of --personal, both flows being normalized before their weighting.
+ */
+#define PERSONAL_FLOW_SCALE 1000000000.0
+
+/**
+ * @def PERSONAL_MIN_LETTERS
+ * @brief Below this number of letters typed, the personal counts are too few to tell more than the typed words.
+ */
+#define PERSONAL_MIN_LETTERS 20000
+
+/**
+ * @brief Prints a layout the way GP4k_TilesMapping.h declares it.
+ * @param Out The stream to print to.
+ * @param Layout The layout to print.
+ */
+static void PrintTilesMapping(QTextStream &Out, const LetterLayout_t &Layout){
+    for(const bool Upper : {false, true}){
+        Out << (Upper ? "    { // SHIFTED\n" : "    { // NOT_SHIFTED\n");
+        for(const std::string &Group : Layout){
+            Out << "        {";
+            for(size_t Tile = 0; Tile < Group.size(); Tile++){
+                const QChar Letter = QChar::fromLatin1(Group[Tile]);
+                Out << ((Tile == 0) ? "\"" : ", \"") << (Upper ? Letter.toUpper() : Letter) << "\"";
+            }
+            Out << "},\n";
+        }
+        Out << "    },\n";
+    }
+    Out << "    // OuterTilesTexts\n";
+    for(const std::string &Group : Layout){
+        QStringList Letters;
+        for(const char Letter : Group){
+            Letters << QString(QChar::fromLatin1(Letter));
+        }
+        Out << "        \"" << Letters.join(' ') << "\",\n";
+    }
+}
+
+/**
+ * @brief Writes a layout the way the --layout option reads it.
+ * @param Layout The layout to write.
+ * @return The groups, separated by spaces.
+ */
+static QString LayoutText(const LetterLayout_t &Layout){
+    QStringList Groups;
+    for(const std::string &Group : Layout){
+        Groups << QString::fromStdString(Group);
+    }
+    return Groups.join(' ');
+}
+
+/**
+ * @brief Opens a corpus as UTF-8.
+ * @param File The file of the corpus, opened by the call.
+ * @param Corpus Receives the stream reading it.
+ * @return False if the file can't be opened.
+ */
+static bool OpenCorpus(QFile &File, QTextStream &Corpus){
+    if(!File.open(QIODevice::ReadOnly | QIODevice::Text)){
+        qCritical() << "Cannot open" << File.fileName();
+        return false;
+    }
+    Corpus.setDevice(&File);
+    Corpus.setCodec("UTF-8");
+    return true;
+}
+
+/**
+ * @brief The QAP cost of a layout, in the problem of its own group sizes.
+ * @param Layout The layout, whose groups may be sized unlike the reference ones.
+ * @param Flow The flow matrix, as built by LoadBigramFlow.
+ * @return The cost of the layout.
+ */
+static int64_t LayoutCost(const LetterLayout_t &Layout, const std::vector<int64_t> &Flow){
+    std::vector<int> GroupSizes;
+    for(const std::string &Group : Layout){
+        GroupSizes.push_back(static_cast<int>(Group.size()));
+    }
+    return QapSolver(MakeLayoutProblem(GroupSizes, Flow)).Cost(LayoutToAssignment(Layout));
+}
+
+/**
+ * @brief Warns about the lines of a counts file skipped as their count is unreadable.
+ * @param Path The counts file.
+ * @param BadLines The numbers of the skipped lines, as filled by LoadBigramFlow or LoadLetterCounts.
+ */
+static void ReportBadLines(const QString &Path, const std::vector<int> &BadLines){
+    if(BadLines.empty()){
+        return;
+    }
+    QStringList Numbers;
+    for(const int LineNumber : BadLines){
+        Numbers.append(QString::number(LineNumber));
+    }
+    qWarning().noquote() << "Skipped" << BadLines.size() << "lines with an unreadable count in" << Path
+                         << "- lines" << Numbers.join(", ");
+}
+
+/**
+ * @brief Places the letters, the D-pad punctuation and the suggestion tiles together, from trigram counts.
+ * @param Reference The reference layout, whose groups count is kept.
+ * @param Counts The trigram counts.
+ * @param Settings The parameters of the problem.
+ * @param Tabu The parameters of the search.
+ * @param CorpusPath The corpus to replay the best layouts on, empty to skip the replay.
+ * @param CorpusLines Stop the replay after this number of lines, 0 to read the whole corpus.
+ * @param MaxCandidates Distinct layouts of the search replayed next to the reference.
+ * @param UseSuggestions False to replay without the suggestion tiles.
+ * @param Out The stream to print to.
+ * @return The exit code.
+ */
+static int RunExtended(const LetterLayout_t &Reference, const std::vector<int64_t> &Counts, const ExtendedSettings_t &Settings,
+                       const TabuSettings_t &Tabu, const QString &CorpusPath, const int CorpusLines, const int MaxCandidates,
+                       const bool UseSuggestions, QTextStream &Out){
+    const ExtendedProblem Problem(Counts, static_cast<int>(Reference.size()), Settings);
+    const std::vector<int> ReferenceAssignment = Problem.AssignmentOf(Reference);
+    if(!Problem.IsFeasible() || ReferenceAssignment.empty()){
+        qCritical() << "The letters must fit on the first" << EXTENDED_ACCESSIBLE_TILES << "tiles of at most"
+                    << EXTENDED_ACCESSIBLE_TILES << "groups, with" << Settings.TilesPerGroup << "tiles per group";
+        return 2;
+    }
+
+    QElapsedTimer Clock;
+    Clock.start();
+    const TabuReport_t Report = ExtendedSolver(Problem).Solve(Tabu);
+    const double Seconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+
+    const int64_t ReferenceCost = Problem.Cost(ReferenceAssignment);
+    std::vector<int> Selected = Report.Best.Assignment;
+    Out << "trigrams: " << Problem.TrigramsCount() << "\n"
+        << "trigram_mass_kept: " << Problem.KeptMass() << "\n"
+        << "reference_cost: " << static_cast<double>(ReferenceCost) / EXTENDED_COST_SCALE << "\n"
+        << "best_cost: " << static_cast<double>(Report.Best.Cost) / EXTENDED_COST_SCALE << "\n"
+        << "improvement: " << 1.0 - static_cast<double>(Report.Best.Cost) / ReferenceCost << "\n"
+        << "best_start: " << Report.Best.Start << "\n"
+        << "best_hits: " << Report.BestHits << "/" << qMax(Tabu.Starts, 1) << "\n"
+        << "evaluated_swaps: " << Report.EvaluatedSwaps << "\n"
+        << "swaps_per_s: " << Report.EvaluatedSwaps / Seconds << "\n"
+        << "elapsed_s: " << Seconds << "\n";
+
+    if(!CorpusPath.isEmpty()){
+        // As for the letters: the distinct best layouts are replayed next to the reference, which wins the ties
+        QVector<std::vector<int>> Assignments = {ReferenceAssignment};
+        QStringList Texts = {Problem.LayoutText(ReferenceAssignment)};
+        for(const QapSolution_t &Solution : Report.Solutions){
+            if(Assignments.length() > MaxCandidates){
+                break;
+            }
+            if(!Texts.contains(Problem.LayoutText(Solution.Assignment))){
+                Assignments.append(Solution.Assignment);
+                Texts.append(Problem.LayoutText(Solution.Assignment));
+            }
+        }
+
+        QFile CorpusFile(CorpusPath);
+        QTextStream Corpus;
+        if(!OpenCorpus(CorpusFile, Corpus) || !Trie::Shared()->IsLoaded()){
+            return 2;
+        }
+        QVector<LayoutCandidate_t> Candidates;
+        for(const std::vector<int> &Assignment : Assignments){
+            Candidates.append(Problem.Candidate(ShippedCandidate(), Assignment));
+        }
+        const LayoutEvaluator Evaluator(Trie::Shared(), UseSuggestions);
+        const QVector<MoveCounts_t> Moves = Evaluator.Evaluate(Corpus, Candidates, CorpusLines);
+
+        int SelectedIndex = 0;
+        for(int Index = 0; Index < Assignments.length(); Index++){
+            const double Characters = qMax<qint64>(Moves[Index].Characters, 1);
+            Out << "candidate: " << Index
+                << " | extended_cost " << static_cast<double>(Problem.Cost(Assignments[Index])) / EXTENDED_COST_SCALE
+                << " | moves_per_char " << Moves[Index].Moves() / Characters
+                << " | suggestions_per_word " << static_cast<double>(Moves[Index].AcceptedSuggestions) / qMax<qint64>(Moves[Index].Words, 1) << "\n";
+            if(Moves[Index].Moves() < Moves[SelectedIndex].Moves()){
+                SelectedIndex = Index;
+            }
+        }
+        Selected = Assignments[SelectedIndex];
+        Out << "selected_candidate: " << SelectedIndex << "\n";
+    }
+
+    QStringList Errors;
+    if(!Problem.CheckLayout(Selected, Errors)){
+        qCritical() << "The selected layout doesn't load:" << Errors;
+        return 2;
+    }
+    Out << "\n# The first groups and the D-pad, for a copy of Layouts/Default.layout\n" << Problem.LayoutText(Selected);
+    return 0;
+}
+
+/**
+ * @brief Places the letters for the counts of a user, blended with global bigrams, and projects the moves saved.
+ * @param Reference The reference layout, whose group sizes are kept.
+ * @param GroupSizes The number of tiles of each group of the reference.
+ * @param GlobalFlow The flow of the global bigrams, as built by LoadBigramFlow.
+ * @param StatsPath The statistics file written by GP4k --stats.
+ * @param Weight The share of the personal counts in the blended flow, from 0 to 1.
+ * @param Tabu The parameters of the search.
+ * @param ApplyPath The layout file to write the personal layout to, empty to only print it.
+ * @param Out The stream to print to.
+ * @return The exit code.
+ */
+static int RunPersonal(const LetterLayout_t &Reference, const std::vector<int> &GroupSizes, const std::vector<int64_t> &GlobalFlow,
+                       const QString &StatsPath, const double Weight, const TabuSettings_t &Tabu, const QString &ApplyPath,
+                       QTextStream &Out){
+    std::vector<int64_t> PersonalFlow;
+    std::vector<int64_t> LetterCounts;
+    std::vector<int> BadLines;
+    if(!LoadBigramFlow(StatsPath.toStdString(), PersonalFlow, &BadLines)
+       || !LoadLetterCounts(StatsPath.toStdString(), LetterCounts, &BadLines)){
+        qCritical() << "Cannot open" << StatsPath;
+        return 2;
+    }
+    std::sort(BadLines.begin(), BadLines.end());
+    ReportBadLines(StatsPath, BadLines);
+    const int64_t PersonalTotal = std::accumulate(PersonalFlow.begin(), PersonalFlow.end(), int64_t(0));
+    const int64_t GlobalTotal = std::accumulate(GlobalFlow.begin(), GlobalFlow.end(), int64_t(0));
+    if(PersonalTotal == 0 || GlobalTotal == 0){
+        qCritical() << "No bigram to optimize for in" << StatsPath;
+        return 2;
+    }
+    // A file holding only bigrams, such as count_2l.txt, gives the characters from its bigrams
+    int64_t Letters = std::accumulate(LetterCounts.begin(), LetterCounts.end(), int64_t(0));
+    Letters = (Letters > 0) ? Letters : PersonalTotal / 2;
+    if(Letters < PERSONAL_MIN_LETTERS){
+        qWarning() << "Only" << Letters << "letters typed: the personal layout may fit the words typed rather than the user";
+    }
+
+    // Both flows are normalized first, so the weight doesn't depend on how long the user typed
+    std::vector<int64_t> Flow(GlobalFlow.size());
+    for(size_t Index = 0; Index < Flow.size(); Index++){
+        Flow[Index] = std::llround(PERSONAL_FLOW_SCALE * (Weight * PersonalFlow[Index] / PersonalTotal
+                                                          + (1.0 - Weight) * GlobalFlow[Index] / GlobalTotal));
+    }
+
+    QElapsedTimer Clock;
+    Clock.start();
+    const TabuReport_t Report = QapSolver(MakeLayoutProblem(GroupSizes, Flow)).Solve(Tabu);
+    const double Seconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+    const LetterLayout_t Personal = AssignmentToLayout(Report.Best.Assignment, GroupSizes, Flow);
+
+    /* The projection only reads the personal counts: the moves between
+     * two letters typed, the flow counting each bigram twice. */
+    const QapSolver Projection(MakeLayoutProblem(GroupSizes, PersonalFlow));
+    const double ReferenceMoves = Projection.Cost(LayoutToAssignment(Reference)) / 2.0 / Letters;
+    const double PersonalMoves = Projection.Cost(LayoutToAssignment(Personal)) / 2.0 / Letters;
+
+    Out << "personal_letters: " << Letters << "\n"
+        << "personal_weight: " << Weight << "\n"
+        << "reference_moves_per_char: " << ReferenceMoves << "\n"
+        << "personal_moves_per_char: " << PersonalMoves << "\n"
+        << "projected_improvement: " << 1.0 - PersonalMoves / ReferenceMoves << "\n"
+        << "best_start: " << Report.Best.Start << "\n"
+        << "best_hits: " << Report.BestHits << "/" << qMax(Tabu.Starts, 1) << "\n"
+        << "elapsed_s: " << Seconds << "\n"
+        << "layout: " << LayoutText(Personal) << "\n";
+
+    if(ApplyPath.isEmpty()){
+        Out << "applied: no, pass --apply <file> to write it\n";
+        return 0;
+    }
+    if(PersonalMoves >= ReferenceMoves){
+        Out << "applied: no, the reference layout needs no more moves\n";
+        return 0;
+    }
+
+    // The other groups and the buttons of an existing layout file are kept
+    KeyboardLayout Base = KeyboardLayout::Builtin();
+    KeyboardLayout Layout;
+    QStringList Errors;
+    if(QFile::exists(ApplyPath) && !KeyboardLayout::Load(ApplyPath, Base, Errors)){
+        qCritical().noquote().nospace() << "Invalid layout " << ApplyPath << ":\n    " << Errors.join("\n    ");
+        return 2;
+    }
+    QStringList Groups;
+    for(const std::string &Group : Personal){
+        Groups << QString::fromStdString(Group);
+    }
+    if(!Base.WithLetters(Groups, Layout, Errors)){
+        qCritical().noquote().nospace() << "The personal layout doesn't fit " << ApplyPath << ":\n    " << Errors.join("\n    ");
+        return 2;
+    }
+
+    // Replaced at once, for a GP4k reloading it with --layout
+    QSaveFile File(ApplyPath);
+    if(!File.open(QIODevice::WriteOnly | QIODevice::Text) || File.write(Layout.ToText().toUtf8()) < 0 || !File.commit()){
+        qCritical() << "Cannot write" << ApplyPath;
+        return 2;
+    }
+    Out << "applied: " << ApplyPath << "\n";
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Places the letters on the char groups by solving their QAP with a multi-start tabu search; "
+                                     "with --extended, the D-pad punctuation and the suggestion tiles as well; "
+                                     "with --personal, for the letters a user typed.");
+    Parser.addHelpOption();
+    Parser.addPositionalArgument("bigrams", "The bigrams count file, such as Python/Generating_Disposition/count_2l.txt. "
+                                 "Not used with --extended.");
+    const QCommandLineOption StartsOption("starts", "Independent searches, each from a random layout.", "starts", "64");
+    const QCommandLineOption IterationsOption("iterations", "Swaps performed by each search.", "iterations", "5000");
+    const QCommandLineOption SeedOption("seed", "Seed of the first search; the Nth one uses seed + N.", "seed", "1");
+    const QCommandLineOption ThreadsOption("threads", "Threads sharing the searches, 0 for one per core.", "threads", "0");
+    const QCommandLineOption LayoutOption("layout", "The reference layout, as space separated groups. Also gives the "
+                                          "size of each group.", "layout", SHIPPED_LAYOUT);
+    const QCommandLineOption CorpusOption("corpus", "Re-rank the best layouts by the moves needed to type <file>.", "file");
+    const QCommandLineOption CorpusLinesOption("corpus-lines", "Stop after <lines> lines of the corpus.", "lines", "0");
+    const QCommandLineOption CandidatesOption("candidates", "Distinct layouts of the search re-ranked on the corpus.", "count", "16");
+    const QCommandLineOption CompareOption("compare", "Another layout to evaluate on the corpus. Can be repeated.", "layout");
+    const QCommandLineOption NoSuggestionsOption("no-suggestions", "Evaluate the corpus without the suggestion tiles.");
+    const QCommandLineOption ExtendedOption("extended", "Also place the D-pad punctuation and the suggestion tiles, from "
+                                            "trigrams: those of --trigrams, else those of --corpus.");
+    const QCommandLineOption TrigramsOption("trigrams", "The trigrams count file, in the format of count_2l.txt.", "file");
+    const QCommandLineOption SixBySixOption("six-by-six", "Groups of 6 tiles, for the accessibility layout.");
+    const QCommandLineOption SuggestionGainOption("suggestion-gain", "Moves saved per letter typed in a group by its "
+                                                  "first suggestion tile.", "moves", "0.3");
+    const QCommandLineOption SuggestionDecayOption("suggestion-decay", "Ratio of the gain of a suggestion tile to the "
+                                                   "previous one.", "ratio", "0.5");
+    const QCommandLineOption TrigramLimitOption("trigram-limit", "The most frequent trigrams kept in the objective.", "count", "8192");
+    const QCommandLineOption PersonalOption("personal", "Place the letters for the counts GP4k --stats wrote in <file>, "
+                                            "blended with the bigrams.", "file");
+    const QCommandLineOption PersonalWeightOption("personal-weight", "Share of the personal counts in the blend.", "weight", "0.5");
+    const QCommandLineOption ApplyOption("apply", "With --personal, write the personal layout to the layout <file>, "
+                                         "keeping its other groups and buttons.", "file");
+    Parser.addOptions({StartsOption, IterationsOption, SeedOption, ThreadsOption, LayoutOption,
+                       CorpusOption, CorpusLinesOption, CandidatesOption, CompareOption, NoSuggestionsOption,
+                       ExtendedOption, TrigramsOption, SixBySixOption, SuggestionGainOption, SuggestionDecayOption,
+                       TrigramLimitOption, PersonalOption, PersonalWeightOption, ApplyOption});
+    Parser.process(a);
+
+    if(Parser.positionalArguments().length() != (Parser.isSet(ExtendedOption) ? 0 : 1)){
+        Parser.showHelp(2);
+    }
+
+    LetterLayout_t Reference;
+    if(!ParseLayout(Parser.value(LayoutOption).toStdString(), Reference)){
+        qCritical() << "The layout must hold each letter exactly once:" << Parser.value(LayoutOption);
+        return 2;
+    }
+    std::vector<int> GroupSizes;
+    for(const std::string &Group : Reference){
+        GroupSizes.push_back(static_cast<int>(Group.size()));
+    }
+
+    const TabuSettings_t Settings = {
+        Parser.value(StartsOption).toInt(),
+        Parser.value(IterationsOption).toLongLong(),
+        Parser.value(SeedOption).toULongLong(),
+        Parser.value(ThreadsOption).toInt()
+    };
+    QTextStream Out(stdout);
+
+    if(Parser.isSet(ExtendedOption)){
+        std::vector<int64_t> Counts;
+        if(Parser.isSet(TrigramsOption)){
+            if(!LoadTrigramCounts(Parser.value(TrigramsOption), Counts)){
+                qCritical() << "Cannot open" << Parser.value(TrigramsOption);
+                return 2;
+            }
+        }else if(Parser.isSet(CorpusOption)){
+            QFile CorpusFile(Parser.value(CorpusOption));
+            QTextStream Corpus;
+            if(!OpenCorpus(CorpusFile, Corpus)){
+                return 2;
+            }
+            CountTrigrams(Corpus, Parser.value(CorpusLinesOption).toInt(), Counts);
+        }else{
+            qCritical() << "--extended needs the trigrams of --trigrams or of --corpus";
+            return 2;
+        }
+        const ExtendedSettings_t Extended = {
+            Parser.isSet(SixBySixOption) ? EXTENDED_ACCESSIBLE_TILES : static_cast<int>(NUMBER_OF_TILES),
+            Parser.value(SuggestionGainOption).toDouble(),
+            Parser.value(SuggestionDecayOption).toDouble(),
+            Parser.value(TrigramLimitOption).toInt()
+        };
+        return RunExtended(Reference, Counts, Extended, Settings, Parser.value(CorpusOption),
+                           Parser.value(CorpusLinesOption).toInt(), Parser.value(CandidatesOption).toInt(),
+                           !Parser.isSet(NoSuggestionsOption), Out);
+    }
+
+    std::vector<int64_t> Flow;
+    std::vector<int> BadLines;
+    if(!LoadBigramFlow(Parser.positionalArguments()[0].toStdString(), Flow, &BadLines)){
+        qCritical() << "Cannot open" << Parser.positionalArguments()[0];
+        return 2;
+    }
+    ReportBadLines(Parser.positionalArguments()[0], BadLines);
+
+    if(Parser.isSet(PersonalOption)){
+        const double Weight = qBound(0.0, Parser.value(PersonalWeightOption).toDouble(), 1.0);
+        return RunPersonal(Reference, GroupSizes, Flow, Parser.value(PersonalOption), Weight, Settings,
+                           Parser.value(ApplyOption), Out);
+    }
+
+    const QapSolver Solver(MakeLayoutProblem(GroupSizes, Flow));
+
+    QElapsedTimer Clock;
+    Clock.start();
+    const TabuReport_t Report = Solver.Solve(Settings);
+    const double Seconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+
+    const int64_t ReferenceCost = Solver.Cost(LayoutToAssignment(Reference));
+    LetterLayout_t Selected = AssignmentToLayout(Report.Best.Assignment, GroupSizes, Flow);
+
+    Out << "reference_cost: " << static_cast<double>(ReferenceCost) << "\n"
+        << "best_cost: " << static_cast<double>(Report.Best.Cost) << "\n"
+        << "improvement: " << 1.0 - static_cast<double>(Report.Best.Cost) / ReferenceCost << "\n"
+        << "best_start: " << Report.Best.Start << "\n"
+        << "best_hits: " << Report.BestHits << "/" << qMax(Settings.Starts, 1) << "\n"
+        << "evaluated_swaps: " << Report.EvaluatedSwaps << "\n"
+        << "swaps_per_s: " << Report.EvaluatedSwaps / Seconds << "\n"
+        << "elapsed_s: " << Seconds << "\n";
+
+    if(Parser.isSet(CorpusOption)){
+        /* The QAP only counts the group changes between letters: the
+         * distinct layouts it ranks best are replayed on the corpus, with
+         * the shift, the buttons and the suggestions, to pick the one with
+         * the fewest moves. The reference is first, so it wins the ties. */
+        QVector<LetterLayout_t> Layouts = {Reference};
+        for(const QapSolution_t &Solution : Report.Solutions){
+            const LetterLayout_t Layout = AssignmentToLayout(Solution.Assignment, GroupSizes, Flow);
+            if(Layouts.length() > Parser.value(CandidatesOption).toInt()){
+                break;
+            }
+            if(!Layouts.contains(Layout)){
+                Layouts.append(Layout);
+            }
+        }
+        for(const QString &Text : Parser.values(CompareOption)){
+            LetterLayout_t Layout;
+            if(!ParseLayout(Text.toStdString(), Layout)){
+                qCritical() << "The layout must hold each letter exactly once:" << Text;
+                return 2;
+            }
+            Layouts.append(Layout);
+        }
+
+        QFile CorpusFile(Parser.value(CorpusOption));
+        QTextStream Corpus;
+        if(!OpenCorpus(CorpusFile, Corpus) || !Trie::Shared()->IsLoaded()){
+            return 2;
+        }
+
+        QVector<LayoutCandidate_t> Candidates;
+        for(const LetterLayout_t &Layout : Layouts){
+            Candidates.append(CandidateWithLetters(ShippedCandidate(), Layout));
+        }
+        const LayoutEvaluator Evaluator(Trie::Shared(), !Parser.isSet(NoSuggestionsOption));
+        Clock.restart();
+        const QVector<MoveCounts_t> Counts = Evaluator.Evaluate(Corpus, Candidates, Parser.value(CorpusLinesOption).toInt());
+        const double EvaluationSeconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+
+        int SelectedIndex = 0;
+        for(int Index = 0; Index < Layouts.length(); Index++){
+            const MoveCounts_t &Moves = Counts[Index];
+            const double Characters = qMax<qint64>(Moves.Characters, 1);
+            Out << "candidate: " << LayoutText(Layouts[Index])
+                << " | qap_cost " << static_cast<double>(LayoutCost(Layouts[Index], Flow))
+                << " | moves_per_char " << Moves.Moves() / Characters
+                << " | group_moves_per_char " << Moves.GroupMoves / Characters
+                << " | suggestions_per_word " << static_cast<double>(Moves.AcceptedSuggestions) / qMax<qint64>(Moves.Words, 1) << "\n";
+            if(Moves.Moves() < Counts[SelectedIndex].Moves()){
+                SelectedIndex = Index;
+            }
+        }
+        Selected = Layouts[SelectedIndex];
+        Out << "corpus_characters: " << Counts[0].Characters << "\n"
+            << "corpus_skipped_characters: " << Counts[0].SkippedCharacters << "\n"
+            << "evaluation_s: " << EvaluationSeconds << "\n"
+            << "selected_candidate: " << SelectedIndex << "\n";
+    }
+
+    Out << "layout: " << LayoutText(Selected) << "\n\n";
+    PrintTilesMapping(Out, Selected);
+
+    return 0;
+}
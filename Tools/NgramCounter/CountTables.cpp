@@ -0,0 +1,99 @@
+#include <algorithm>
+
+#include "CountTables.h"
+
+/**
+ * @brief Hashes the text of a word, with FNV-1a.
+ * @param Word The UTF-8 text.
+ * @return Its hash.
+ */
+static uint64_t WordHash(const std::string_view &Word){
+    uint64_t Hash = 0xCBF29CE484222325ull;
+    for(const char Byte : Word){
+        Hash = (Hash ^ static_cast<unsigned char>(Byte)) * 0x100000001B3ull;
+    }
+    return Hash;
+}
+
+CountTable::CountTable(const size_t Capacity)
+    : _Size(0)
+{
+    size_t Slots = 16;
+    _Shift = 60;
+    while(Slots < Capacity){
+        Slots *= 2;
+        _Shift--;
+    }
+    _Slots.assign(Slots, {COUNT_TABLE_EMPTY, 0});
+    _Mask = Slots - 1;
+}
+
+void CountTable::Grow(void){
+    std::vector<CountEntry_t> Previous(2 * _Slots.size(), {COUNT_TABLE_EMPTY, 0});
+    Previous.swap(_Slots);
+    _Mask = _Slots.size() - 1;
+    _Shift--;
+    for(const CountEntry_t &Entry : Previous){
+        if(Entry.Key != COUNT_TABLE_EMPTY){
+            size_t Slot = Hash(Entry.Key);
+            while(_Slots[Slot].Key != COUNT_TABLE_EMPTY){
+                Slot = (Slot + 1) & _Mask;
+            }
+            _Slots[Slot] = Entry;
+        }
+    }
+}
+
+std::vector<CountEntry_t> CountTable::Sorted(const uint64_t MinCount) const{
+    std::vector<CountEntry_t> Entries;
+    Entries.reserve(_Size);
+    for(const CountEntry_t &Entry : _Slots){
+        if(Entry.Key != COUNT_TABLE_EMPTY && Entry.Count >= MinCount){
+            Entries.push_back(Entry);
+        }
+    }
+    std::sort(Entries.begin(), Entries.end(), [](const CountEntry_t &A, const CountEntry_t &B){
+        return (A.Count != B.Count) ? A.Count > B.Count : A.Key < B.Key;
+    });
+    return Entries;
+}
+
+WordTable::WordTable()
+    : _Slots(1024, 0)
+    , _Mask(1023)
+{
+}
+
+uint32_t WordTable::Add(const std::string_view &Word, const uint64_t Count){
+    const uint64_t Hash = WordHash(Word);
+    size_t Slot = Hash & _Mask;
+    while(_Slots[Slot] != 0){
+        WordEntry_t &Entry = _Entries[_Slots[Slot] - 1];
+        if(Entry.Hash == Hash && Entry.Length == Word.size() && _Arena.compare(Entry.Offset, Entry.Length, Word) == 0){
+            Entry.Count += Count;
+            return _Slots[Slot] - 1;
+        }
+        Slot = (Slot + 1) & _Mask;
+    }
+
+    const uint32_t Id = static_cast<uint32_t>(_Entries.size());
+    _Entries.push_back({Hash, _Arena.size(), static_cast<uint32_t>(Word.size()), Count});
+    _Arena.append(Word);
+    _Slots[Slot] = Id + 1;
+    if(2 * _Entries.size() > _Slots.size()){
+        Grow();
+    }
+    return Id;
+}
+
+void WordTable::Grow(void){
+    _Slots.assign(2 * _Slots.size(), 0);
+    _Mask = _Slots.size() - 1;
+    for(uint32_t Id = 0; Id < _Entries.size(); Id++){
+        size_t Slot = _Entries[Id].Hash & _Mask;
+        while(_Slots[Slot] != 0){
+            Slot = (Slot + 1) & _Mask;
+        }
+        _Slots[Slot] = Id + 1;
+    }
+}
@@ -0,0 +1,172 @@
+/* CountTables.h */
+
+#ifndef COUNTTABLES_H
+#define COUNTTABLES_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @def COUNT_TABLE_EMPTY
+ * @brief The key of the empty slots of a CountTable, which can't be counted.
+ */
+#define COUNT_TABLE_EMPTY UINT64_MAX
+
+/**
+ * @brief A key of a CountTable and its count.
+ */
+struct CountEntry_t {
+    uint64_t Key;   /**< The key, COUNT_TABLE_EMPTY for an empty slot. */
+    uint64_t Count; /**< Its occurrences. */
+};
+
+/**
+ * @brief The CountTable class counts 64 bits keys, such as packed code points, in an open addressing hash table.
+ *
+ * @details The slots are probed linearly over a power of two capacity, kept at most half full: counting a key is a
+ * multiplication, a shift and most of the time a single cache line, with no allocation once the table has grown.
+ */
+class CountTable {
+public: // Methods
+    /**
+     * @brief Constructor of an empty CountTable.
+     * @param Capacity The initial number of slots, rounded up to a power of two.
+     */
+    explicit CountTable(const size_t Capacity = 1024);
+
+    /**
+     * @brief Adds occurrences of a key.
+     * @param Key The key, not COUNT_TABLE_EMPTY.
+     * @param Count The occurrences to add.
+     */
+    inline void Add(const uint64_t Key, const uint64_t Count = 1){
+        size_t Slot = Hash(Key);
+        while(_Slots[Slot].Key != Key){
+            if(_Slots[Slot].Key == COUNT_TABLE_EMPTY){
+                _Slots[Slot] = {Key, Count};
+                if(2 * ++_Size > _Slots.size()){
+                    Grow();
+                }
+                return;
+            }
+            Slot = (Slot + 1) & _Mask;
+        }
+        _Slots[Slot].Count += Count;
+    }
+
+    /**
+     * @brief Getter for the number of distinct keys.
+     * @return The keys counted at least once.
+     */
+    inline size_t Size(void) const { return _Size; }
+
+    /**
+     * @brief Getter for the slots, for the callers iterating over the keys.
+     * @return The slots, the empty ones included.
+     */
+    inline const std::vector<CountEntry_t> &Slots(void) const { return _Slots; }
+
+    /**
+     * @brief Lists the keys by decreasing count.
+     * @param MinCount The keys counted less are left out.
+     * @return The entries, the lowest key first among equal counts.
+     */
+    std::vector<CountEntry_t> Sorted(const uint64_t MinCount) const;
+
+private: // Methods
+    /**
+     * @brief The first slot of a key: the high bits of a Fibonacci hash, which depend on all the packed code points.
+     */
+    inline size_t Hash(const uint64_t Key) const { return static_cast<size_t>((Key * 0x9E3779B97F4A7C15ull) >> _Shift); }
+
+    /**
+     * @brief Doubles the capacity and places the keys again.
+     */
+    void Grow(void);
+
+private: // Attributes
+    std::vector<CountEntry_t> _Slots;
+    size_t _Mask;
+    int _Shift;
+    size_t _Size;
+};
+
+/**
+ * @brief A word of a WordTable.
+ */
+struct WordEntry_t {
+    uint64_t Hash;   /**< The hash of its text. */
+    uint64_t Offset; /**< Its text, in the arena of the WordTable. */
+    uint32_t Length; /**< The bytes of its text. */
+    uint64_t Count;  /**< Its occurrences. */
+};
+
+/**
+ * @brief The WordTable class counts words and gives each one an id, in the order they were first met.
+ *
+ * @details The texts are stored one after the other in a single arena, and the slots of the open addressing table
+ * only hold the ids: a word already met costs a hash and a comparison, never an allocation. The ids let a CountTable
+ * count the word bigrams as packed pairs.
+ */
+class WordTable {
+public: // Methods
+    /**
+     * @brief Constructor of an empty WordTable.
+     */
+    WordTable();
+
+    /**
+     * @brief Adds occurrences of a word.
+     * @param Word The UTF-8 text of the word.
+     * @param Count The occurrences to add.
+     * @return The id of the word.
+     */
+    uint32_t Add(const std::string_view &Word, const uint64_t Count = 1);
+
+    /**
+     * @brief Getter for the number of distinct words.
+     * @return The words counted, their ids going from 0 to Size() - 1.
+     */
+    inline size_t Size(void) const { return _Entries.size(); }
+
+    /**
+     * @brief Getter for the text of a word.
+     * @param Id The id of the word.
+     * @return Its UTF-8 text, valid until the next Add.
+     */
+    inline std::string_view Text(const uint32_t Id) const { return std::string_view(_Arena).substr(_Entries[Id].Offset, _Entries[Id].Length); }
+
+    /**
+     * @brief Getter for the occurrences of a word.
+     * @param Id The id of the word.
+     * @return Its count.
+     */
+    inline uint64_t Count(const uint32_t Id) const { return _Entries[Id].Count; }
+
+private: // Methods
+    /**
+     * @brief Doubles the capacity and places the ids again.
+     */
+    void Grow(void);
+
+private: // Attributes
+    /**
+     * @brief The slots of the table: the id of a word plus one, 0 for an empty slot.
+     */
+    std::vector<uint32_t> _Slots;
+    size_t _Mask;
+
+    /**
+     * @brief The words, by id.
+     */
+    std::vector<WordEntry_t> _Entries;
+
+    /**
+     * @brief The texts of the words, one after the other.
+     */
+    std::string _Arena;
+};
+
+#endif // COUNTTABLES_H
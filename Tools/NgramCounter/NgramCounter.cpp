@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <QChar>
+
+#include "NgramCounter.h"
+
+/**
+ * @def NGRAM_APOSTROPHE
+ * @brief The apostrophe of the words, as in Resources/trie_word_list.txt.
+ */
+#define NGRAM_APOSTROPHE 0x2019
+
+/**
+ * @brief Decodes the UTF-8 code point at a position.
+ * @param Bytes The text.
+ * @param End The byte following the text that may be read.
+ * @param Position The first byte of the code point, moved past it.
+ * @return The code point, NGRAM_SPLIT if the bytes are not valid UTF-8.
+ */
+static inline int32_t DecodeUtf8(const unsigned char *Bytes, const int64_t End, int64_t &Position){
+    const unsigned char Lead = Bytes[Position++];
+    if(Lead < 0x80){
+        return Lead;
+    }
+    int Following = 0;
+    int32_t CodePoint = 0;
+    if((Lead & 0xE0) == 0xC0){
+        Following = 1;
+        CodePoint = Lead & 0x1F;
+    }else if((Lead & 0xF0) == 0xE0){
+        Following = 2;
+        CodePoint = Lead & 0x0F;
+    }else if((Lead & 0xF8) == 0xF0){
+        Following = 3;
+        CodePoint = Lead & 0x07;
+    }else{ // A continuation byte out of place
+        return NGRAM_SPLIT;
+    }
+    for(int Index = 0; Index < Following; Index++){
+        if(Position >= End || (Bytes[Position] & 0xC0) != 0x80){
+            return NGRAM_SPLIT;
+        }
+        CodePoint = (CodePoint << 6) | (Bytes[Position++] & 0x3F);
+    }
+    return CodePoint;
+}
+
+/**
+ * @brief Appends a code point to a UTF-8 text.
+ * @param Text The text.
+ * @param CodePoint A valid code point.
+ */
+static inline void AppendUtf8(std::string &Text, const int32_t CodePoint){
+    if(CodePoint < 0x80){
+        Text += static_cast<char>(CodePoint);
+    }else if(CodePoint < 0x800){
+        Text += static_cast<char>(0xC0 | (CodePoint >> 6));
+        Text += static_cast<char>(0x80 | (CodePoint & 0x3F));
+    }else if(CodePoint < 0x10000){
+        Text += static_cast<char>(0xE0 | (CodePoint >> 12));
+        Text += static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+        Text += static_cast<char>(0x80 | (CodePoint & 0x3F));
+    }else{
+        Text += static_cast<char>(0xF0 | (CodePoint >> 18));
+        Text += static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+        Text += static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+        Text += static_cast<char>(0x80 | (CodePoint & 0x3F));
+    }
+}
+
+/**
+ * @brief The character counted for a code point.
+ * @param CodePoint A code point, or NGRAM_SPLIT.
+ * @return The code point in lower case, a space for every space character, NGRAM_SPLIT for the control characters.
+ */
+static inline int32_t CountedChar(const int32_t CodePoint){
+    if(CodePoint < 0x80){ // Most of the text: no table lookup
+        if(CodePoint >= 'A' && CodePoint <= 'Z'){
+            return CodePoint + ('a' - 'A');
+        }
+        if(CodePoint == '\t' || CodePoint == '\v' || CodePoint == '\f'){
+            return ' ';
+        }
+        return (CodePoint < ' ' || CodePoint == 0x7F) ? NGRAM_SPLIT : CodePoint;
+    }
+    const uint CodePointU = static_cast<uint>(CodePoint);
+    if(QChar::isSpace(CodePointU)){
+        return ' ';
+    }
+    if(QChar::category(CodePointU) == QChar::Other_Control){
+        return NGRAM_SPLIT;
+    }
+    return static_cast<int32_t>(QChar::toLower(CodePointU));
+}
+
+/**
+ * @brief Tells if a counted character belongs to a word.
+ * @param Char A character, as returned by CountedChar.
+ * @return True for a letter.
+ */
+static inline bool IsWordLetter(const int32_t Char){
+    if(Char < 0x80){
+        return Char >= 'a' && Char <= 'z';
+    }
+    return QChar::isLetter(static_cast<uint>(Char));
+}
+
+/**
+ * @brief The last character of the line ending at a line break.
+ * @param Bytes The text.
+ * @param LineBreak The position of the line break.
+ * @return The counted character, a space if the line is empty, NGRAM_SPLIT at the start of the text.
+ */
+static int32_t CharBeforeLineBreak(const unsigned char *Bytes, const int64_t LineBreak){
+    int64_t Last = LineBreak - 1;
+    if(Last >= 0 && Bytes[Last] == '\r'){
+        Last--;
+    }
+    if(Last < 0){
+        return NGRAM_SPLIT;
+    }
+    if(Bytes[Last] == '\n'){ // An empty line, followed by its space
+        return ' ';
+    }
+    int64_t Lead = Last;
+    while(Lead > 0 && Last - Lead < 3 && (Bytes[Lead] & 0xC0) == 0x80){
+        Lead--;
+    }
+    int64_t Position = Lead;
+    const int32_t CodePoint = DecodeUtf8(Bytes, Last + 1, Position);
+    return (Position == Last + 1) ? CountedChar(CodePoint) : NGRAM_SPLIT;
+}
+
+std::string CharNgramText(const uint64_t Key, const int Order){
+    std::string Text;
+    for(int Index = Order - 1; Index >= 0; Index--){
+        AppendUtf8(Text, static_cast<int32_t>((Key >> (Index * NGRAM_CODE_BITS)) & ((1u << NGRAM_CODE_BITS) - 1)));
+    }
+    return Text;
+}
+
+NgramCounter::NgramCounter(const int Threads)
+    : _Threads((Threads > 0) ? Threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency())))
+{
+}
+
+void NgramCounter::CountChunk(const char *Data, const int64_t Size, const int64_t Begin, const int64_t End, NgramCounts_t &Counts){
+    const unsigned char *Bytes = reinterpret_cast<const unsigned char*>(Data);
+
+    // The first n-grams of a chunk start on the previous line, as when the text is read at once
+    int32_t First = (Begin > 0) ? CharBeforeLineBreak(Bytes, Begin - 1) : NGRAM_SPLIT;
+    int32_t Second = (Begin > 0) ? ' ' : NGRAM_SPLIT;
+    const auto CountChar = [&Counts, &First, &Second](const int32_t Third){
+        if(Third != NGRAM_SPLIT){
+            Counts.Characters++;
+            if(Second != NGRAM_SPLIT){
+                Counts.CharBigrams.Add((static_cast<uint64_t>(Second) << NGRAM_CODE_BITS) | Third);
+                if(First != NGRAM_SPLIT){
+                    Counts.CharTrigrams.Add((((static_cast<uint64_t>(First) << NGRAM_CODE_BITS) | Second) << NGRAM_CODE_BITS) | Third);
+                }
+            }
+        }
+        First = Second;
+        Second = Third;
+    };
+
+    std::string Word;
+    bool Apostrophe = false;
+    int64_t PreviousWord = -1;
+    const auto EndWord = [&Counts, &Word, &Apostrophe, &PreviousWord](){
+        Apostrophe = false; // Quoting, not in the word
+        if(Word.empty()){
+            return;
+        }
+        const uint32_t Id = Counts.Words.Add(Word);
+        if(PreviousWord >= 0){
+            Counts.WordBigrams.Add((static_cast<uint64_t>(PreviousWord) << 32) | Id);
+        }
+        PreviousWord = Id;
+        Word.clear();
+    };
+    const auto EndLine = [&](){
+        CountChar(' ');
+        EndWord();
+        PreviousWord = -1;
+        Counts.Lines++;
+    };
+
+    int64_t Position = Begin;
+    while(Position < End){
+        if(Bytes[Position] == '\n'){
+            Position++;
+            EndLine();
+            continue;
+        }
+        if(Bytes[Position] == '\r'){ // Part of the line break
+            Position++;
+            continue;
+        }
+        const int32_t Char = CountedChar(DecodeUtf8(Bytes, End, Position));
+        CountChar(Char);
+        if(IsWordLetter(Char)){
+            if(Apostrophe){
+                AppendUtf8(Word, NGRAM_APOSTROPHE);
+                Apostrophe = false;
+            }
+            AppendUtf8(Word, Char);
+        }else if((Char == '\'' || Char == NGRAM_APOSTROPHE) && !Word.empty()){
+            Apostrophe = true;
+        }else{
+            EndWord();
+            if(Char != ' '){ // A punctuation or a number separates the words
+                PreviousWord = -1;
+            }
+        }
+    }
+    if(End == Size && End > Begin && Bytes[End - 1] != '\n'){ // The last line, with no line break
+        EndLine();
+    }
+}
+
+void NgramCounter::Merge(NgramCounts_t &Into, const NgramCounts_t &From){
+    for(const CountEntry_t &Entry : From.CharBigrams.Slots()){
+        if(Entry.Key != COUNT_TABLE_EMPTY){
+            Into.CharBigrams.Add(Entry.Key, Entry.Count);
+        }
+    }
+    for(const CountEntry_t &Entry : From.CharTrigrams.Slots()){
+        if(Entry.Key != COUNT_TABLE_EMPTY){
+            Into.CharTrigrams.Add(Entry.Key, Entry.Count);
+        }
+    }
+
+    // The ids of the words differ from a table to another
+    std::vector<uint32_t> Ids(From.Words.Size());
+    for(uint32_t Id = 0; Id < From.Words.Size(); Id++){
+        Ids[Id] = Into.Words.Add(From.Words.Text(Id), From.Words.Count(Id));
+    }
+    for(const CountEntry_t &Entry : From.WordBigrams.Slots()){
+        if(Entry.Key != COUNT_TABLE_EMPTY){
+            const uint64_t Key = (static_cast<uint64_t>(Ids[Entry.Key >> 32]) << 32) | Ids[Entry.Key & 0xFFFFFFFFu];
+            Into.WordBigrams.Add(Key, Entry.Count);
+        }
+    }
+
+    Into.Lines += From.Lines;
+    Into.Characters += From.Characters;
+}
+
+int NgramCounter::Count(const char *Data, const int64_t Size){
+    // Chunks of about the same size, each ending with a line break
+    const int64_t Target = std::max<int64_t>(Size / (static_cast<int64_t>(_Threads) * NGRAM_CHUNKS_PER_THREAD), NGRAM_CHUNK_MIN_BYTES);
+    std::vector<int64_t> Bounds = {0};
+    while(Bounds.back() < Size){
+        const int64_t Bound = std::min(Bounds.back() + Target, Size);
+        const void *LineBreak = (Bound < Size) ? std::memchr(Data + Bound, '\n', static_cast<size_t>(Size - Bound)) : nullptr;
+        Bounds.push_back((LineBreak != nullptr) ? static_cast<const char*>(LineBreak) - Data + 1 : Size);
+    }
+    const int Chunks = static_cast<int>(Bounds.size()) - 1;
+    const int Threads = std::clamp(_Threads, 1, std::max(Chunks, 1));
+
+    std::vector<NgramCounts_t> ThreadCounts(Threads);
+    std::atomic<int> NextChunk(0);
+    std::vector<std::thread> Workers;
+    for(int Worker = 0; Worker < Threads; Worker++){
+        Workers.emplace_back([Data, Size, Chunks, Worker, &Bounds, &ThreadCounts, &NextChunk](){
+            for(int Chunk = NextChunk++; Chunk < Chunks; Chunk = NextChunk++){
+                CountChunk(Data, Size, Bounds[Chunk], Bounds[Chunk + 1], ThreadCounts[Worker]);
+            }
+        });
+    }
+    for(std::thread &Worker : Workers){
+        Worker.join();
+    }
+
+    for(const NgramCounts_t &Counts : ThreadCounts){
+        Merge(_Counts, Counts);
+    }
+    return Chunks;
+}
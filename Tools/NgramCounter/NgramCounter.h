@@ -0,0 +1,118 @@
+/* NgramCounter.h */
+
+#ifndef NGRAMCOUNTER_H
+#define NGRAMCOUNTER_H
+
+#include <cstdint>
+#include <string>
+
+#include "CountTables.h"
+
+/**
+ * @def NGRAM_CHUNK_MIN_BYTES
+ * @brief The smallest chunk of text counted by a thread at once.
+ */
+#define NGRAM_CHUNK_MIN_BYTES (1 << 20)
+
+/**
+ * @def NGRAM_CHUNKS_PER_THREAD
+ * @brief The chunks of a text per thread, so that a thread slowed down doesn't delay the others.
+ */
+#define NGRAM_CHUNKS_PER_THREAD 8
+
+/**
+ * @def NGRAM_SPLIT
+ * @brief The code of a character ending the character n-grams, such as a control character or invalid UTF-8.
+ */
+#define NGRAM_SPLIT (-1)
+
+/**
+ * @def NGRAM_CODE_BITS
+ * @brief The bits of a code point in the keys of the character n-grams.
+ */
+#define NGRAM_CODE_BITS 21
+
+/**
+ * @brief The n-grams counted in a text.
+ */
+struct NgramCounts_t {
+    CountTable CharBigrams;  /**< The character bigrams, as two packed code points, the first in the high bits. */
+    CountTable CharTrigrams; /**< The character trigrams, as three packed code points, the first in the high bits. */
+    WordTable Words;         /**< The words. */
+    CountTable WordBigrams;  /**< The word bigrams, as two packed ids of Words, the first in the high 32 bits. */
+    int64_t Lines = 0;       /**< The lines read. */
+    int64_t Characters = 0;  /**< The characters counted, each line followed by a space. */
+};
+
+/**
+ * @brief Writes a character n-gram.
+ * @param Key The n-gram, as counted by the NgramCounter.
+ * @param Order 2 for a bigram, 3 for a trigram.
+ * @return The UTF-8 text of its characters.
+ */
+std::string CharNgramText(const uint64_t Key, const int Order);
+
+/**
+ * @brief The NgramCounter class counts the character and word n-grams of UTF-8 texts, spread over several threads.
+ *
+ * @details A text, usually a memory-mapped file, is cut into chunks ending with a line break. Each thread counts the
+ * chunks it takes into its own tables, with no lock, and the tables are then merged into the counts of the counter:
+ * the counts only depend on the texts, not on the threads.
+ *
+ * The characters are read as CountTrigrams of gp4k-layout-optimizer does: lower case, each line followed by a space,
+ * and every space character is a space. A control character or invalid UTF-8 ends the character n-grams. A word is a
+ * run of letters, lower case, in which an apostrophe is written ’ as in the dictionary; the word bigrams are the
+ * words separated by spaces only, within a line.
+ */
+class NgramCounter {
+public: // Methods
+    /**
+     * @brief Constructor of the NgramCounter.
+     * @param Threads The threads counting a text, 0 for one per core.
+     */
+    explicit NgramCounter(const int Threads);
+
+    /**
+     * @brief Counts a text, adding to the counts of the previous ones.
+     * @param Data The UTF-8 text.
+     * @param Size The bytes of the text.
+     * @return The number of chunks the text was cut into.
+     */
+    int Count(const char *Data, const int64_t Size);
+
+    /**
+     * @brief Getter for the counts of the texts counted so far.
+     * @return The counts.
+     */
+    inline const NgramCounts_t &Counts(void) const { return _Counts; }
+
+    /**
+     * @brief Getter for the number of threads counting a text.
+     * @return At least 1.
+     */
+    inline int Threads(void) const { return _Threads; }
+
+private: // Methods
+    /**
+     * @brief Counts the lines of a chunk.
+     * @param Data The whole text, to read the end of the line before the chunk.
+     * @param Size The bytes of the text.
+     * @param Begin The first byte of the chunk, 0 or just after a line break.
+     * @param End The byte following the chunk, just after a line break or Size.
+     * @param Counts The tables of the thread.
+     */
+    static void CountChunk(const char *Data, const int64_t Size, const int64_t Begin, const int64_t End, NgramCounts_t &Counts);
+
+    /**
+     * @brief Adds the counts of a thread to other counts.
+     * @param Into The counts receiving the others.
+     * @param From The counts of a thread.
+     */
+    static void Merge(NgramCounts_t &Into, const NgramCounts_t &From);
+
+private: // Attributes
+    int _Threads;
+    NgramCounts_t _Counts;
+};
+
+#endif // NGRAMCOUNTER_H
@@ -0,0 +1,20 @@
+# Corpus n-gram counter: counts the character bigrams and trigrams and the word
+# unigrams and bigrams of memory-mapped UTF-8 corpora on all the cores, and
+# writes them for gp4k-layout-optimizer and the dictionary word list.
+
+QT -= gui
+QT += core
+
+CONFIG += c++17 console thread
+CONFIG -= app_bundle
+
+TARGET = gp4k-ngram
+
+SOURCES += \
+    CountTables.cpp \
+    NgramCounter.cpp \
+    main.cpp
+
+HEADERS += \
+    CountTables.h \
+    NgramCounter.h
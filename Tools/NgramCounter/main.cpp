@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include "NgramCounter.h"
+
+/**
+ * @def NGRAM_WRITE_BUFFER_BYTES
+ * @brief The lines are written by blocks of this size, the word bigrams of a large corpus not fitting in memory twice.
+ */
+#define NGRAM_WRITE_BUFFER_BYTES (1 << 20)
+
+/**
+ * @brief Writes a counts file, replacing it at once.
+ * @param Path The file to write.
+ * @param Lines The number of lines to write.
+ * @param AppendLine Appends the line of an index, line break included, to a buffer.
+ * @return False if the file can't be written.
+ */
+static bool WriteLines(const QString &Path, const size_t Lines, const std::function<void(size_t, std::string&)> &AppendLine){
+    QSaveFile File(Path);
+    if(!File.open(QIODevice::WriteOnly)){
+        qCritical() << "Cannot write" << Path;
+        return false;
+    }
+    std::string Buffer;
+    Buffer.reserve(NGRAM_WRITE_BUFFER_BYTES + 256);
+    for(size_t Index = 0; Index < Lines; Index++){
+        AppendLine(Index, Buffer);
+        if(Buffer.size() >= NGRAM_WRITE_BUFFER_BYTES || Index + 1 == Lines){
+            if(File.write(Buffer.data(), static_cast<qint64>(Buffer.size())) < 0){
+                break;
+            }
+            Buffer.clear();
+        }
+    }
+    if(!File.commit()){
+        qCritical() << "Cannot write" << Path;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes character n-grams in the format of count_2l.txt: the characters, a tab and the count on each line.
+ * @param Path The file to write.
+ * @param Table The n-grams.
+ * @param Order 2 for bigrams, 3 for trigrams.
+ * @param MinCount The n-grams counted less are left out.
+ * @return False if the file can't be written.
+ */
+static bool WriteCharNgrams(const QString &Path, const CountTable &Table, const int Order, const uint64_t MinCount){
+    const std::vector<CountEntry_t> Entries = Table.Sorted(MinCount);
+    return WriteLines(Path, Entries.size(), [&Entries, Order](const size_t Index, std::string &Buffer){
+        Buffer += CharNgramText(Entries[Index].Key, Order);
+        Buffer += '\t';
+        Buffer += std::to_string(Entries[Index].Count);
+        Buffer += '\n';
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Counts the character bigrams and trigrams and the word unigrams and bigrams of "
+                                     "UTF-8 corpora, memory-mapped and spread over all the cores.");
+    Parser.addHelpOption();
+    Parser.addPositionalArgument("corpus", "The UTF-8 text files to count, one after the other.", "corpus...");
+    const QCommandLineOption ThreadsOption("threads", "Threads counting a corpus, 0 for one per core.", "threads", "0");
+    const QCommandLineOption BigramsOption("bigrams", "Write the character bigrams to <file>, in the format of count_2l.txt, "
+                                           "read by gp4k-layout-optimizer.", "file");
+    const QCommandLineOption TrigramsOption("trigrams", "Write the character trigrams to <file>, read by "
+                                            "gp4k-layout-optimizer --extended --trigrams.", "file");
+    const QCommandLineOption WordsOption("words", "Write the words and their counts to <file>.", "file");
+    const QCommandLineOption WordBigramsOption("word-bigrams", "Write the word bigrams and their counts to <file>.", "file");
+    const QCommandLineOption WordListOption("word-list", "Write the words by decreasing count to <file>, in the format of "
+                                            "Resources/trie_word_list.txt, whose order ranks the suggestions.", "file");
+    const QCommandLineOption WordListSizeOption("word-list-size", "The most frequent words of --word-list, 0 for all.", "words", "0");
+    const QCommandLineOption MinCountOption("min-count", "Leave out the n-grams counted less than <count> times.", "count", "1");
+    Parser.addOptions({ThreadsOption, BigramsOption, TrigramsOption, WordsOption, WordBigramsOption,
+                       WordListOption, WordListSizeOption, MinCountOption});
+    Parser.process(a);
+
+    if(Parser.positionalArguments().isEmpty()){
+        Parser.showHelp(2);
+    }
+    const uint64_t MinCount = qMax(Parser.value(MinCountOption).toULongLong(), 1ull);
+
+    NgramCounter Counter(Parser.value(ThreadsOption).toInt());
+    qint64 Bytes = 0;
+    int Chunks = 0;
+    QElapsedTimer Clock;
+    Clock.start();
+    for(const QString &Path : Parser.positionalArguments()){
+        QFile File(Path);
+        if(!File.open(QIODevice::ReadOnly)){
+            qCritical() << "Cannot open" << Path;
+            return 2;
+        }
+        if(File.size() == 0){
+            continue;
+        }
+        // Mapped rather than read: the threads share the pages, and a corpus larger than the memory is paged in and out
+        const uchar *Data = File.map(0, File.size());
+        if(Data == nullptr){
+            qCritical() << "Cannot map" << Path << ":" << File.errorString();
+            return 2;
+        }
+        Chunks += Counter.Count(reinterpret_cast<const char*>(Data), File.size());
+        Bytes += File.size();
+        File.unmap(const_cast<uchar*>(Data));
+    }
+    const double CountSeconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+
+    Clock.restart();
+    const NgramCounts_t &Counts = Counter.Counts();
+    bool Written = true;
+    if(Parser.isSet(BigramsOption)){
+        Written = WriteCharNgrams(Parser.value(BigramsOption), Counts.CharBigrams, 2, MinCount) && Written;
+    }
+    if(Parser.isSet(TrigramsOption)){
+        Written = WriteCharNgrams(Parser.value(TrigramsOption), Counts.CharTrigrams, 3, MinCount) && Written;
+    }
+    if(Parser.isSet(WordsOption) || Parser.isSet(WordListOption)){
+        // Sorted by text among equal counts: the ids depend on the order in which the threads met the words
+        std::vector<uint32_t> Words;
+        for(uint32_t Id = 0; Id < Counts.Words.Size(); Id++){
+            if(Counts.Words.Count(Id) >= MinCount){
+                Words.push_back(Id);
+            }
+        }
+        std::sort(Words.begin(), Words.end(), [&Counts](const uint32_t A, const uint32_t B){
+            return (Counts.Words.Count(A) != Counts.Words.Count(B)) ? Counts.Words.Count(A) > Counts.Words.Count(B)
+                                                                    : Counts.Words.Text(A) < Counts.Words.Text(B);
+        });
+        if(Parser.isSet(WordsOption)){
+            Written = WriteLines(Parser.value(WordsOption), Words.size(), [&Words, &Counts](const size_t Index, std::string &Buffer){
+                Buffer += Counts.Words.Text(Words[Index]);
+                Buffer += '\t';
+                Buffer += std::to_string(Counts.Words.Count(Words[Index]));
+                Buffer += '\n';
+            }) && Written;
+        }
+        if(Parser.isSet(WordListOption)){
+            const size_t Size = Parser.value(WordListSizeOption).toULongLong();
+            Written = WriteLines(Parser.value(WordListOption), (Size == 0) ? Words.size() : qMin(Size, Words.size()),
+                                 [&Words, &Counts](const size_t Index, std::string &Buffer){
+                Buffer += Counts.Words.Text(Words[Index]);
+                Buffer += '\n';
+            }) && Written;
+        }
+    }
+    if(Parser.isSet(WordBigramsOption)){
+        std::vector<CountEntry_t> Bigrams = Counts.WordBigrams.Sorted(MinCount);
+        const auto Texts = [&Counts](const uint64_t Key){
+            return std::make_pair(Counts.Words.Text(static_cast<uint32_t>(Key >> 32)), Counts.Words.Text(static_cast<uint32_t>(Key & 0xFFFFFFFFu)));
+        };
+        std::stable_sort(Bigrams.begin(), Bigrams.end(), [&Texts](const CountEntry_t &A, const CountEntry_t &B){
+            return (A.Count != B.Count) ? A.Count > B.Count : Texts(A.Key) < Texts(B.Key);
+        });
+        Written = WriteLines(Parser.value(WordBigramsOption), Bigrams.size(), [&Bigrams, &Counts](const size_t Index, std::string &Buffer){
+            Buffer += Counts.Words.Text(static_cast<uint32_t>(Bigrams[Index].Key >> 32));
+            Buffer += ' ';
+            Buffer += Counts.Words.Text(static_cast<uint32_t>(Bigrams[Index].Key & 0xFFFFFFFFu));
+            Buffer += '\t';
+            Buffer += std::to_string(Bigrams[Index].Count);
+            Buffer += '\n';
+        }) && Written;
+    }
+    const double WriteSeconds = qMax(Clock.nsecsElapsed() / 1e9, 1e-9);
+
+    QTextStream Out(stdout);
+    Out << "files: " << Parser.positionalArguments().length() << "\n"
+        << "bytes: " << Bytes << "\n"
+        << "lines: " << Counts.Lines << "\n"
+        << "characters: " << Counts.Characters << "\n"
+        << "threads: " << Counter.Threads() << "\n"
+        << "chunks: " << Chunks << "\n"
+        << "char_bigrams: " << Counts.CharBigrams.Size() << "\n"
+        << "char_trigrams: " << Counts.CharTrigrams.Size() << "\n"
+        << "words: " << Counts.Words.Size() << "\n"
+        << "word_bigrams: " << Counts.WordBigrams.Size() << "\n"
+        << "count_s: " << CountSeconds << "\n"
+        << "mb_per_s: " << Bytes / 1e6 / CountSeconds << "\n"
+        << "write_s: " << WriteSeconds << "\n";
+
+    return Written ? 0 : 2;
+}
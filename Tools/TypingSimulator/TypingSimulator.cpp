@@ -0,0 +1,307 @@
+#include <cmath>
+#include <limits>
+
+#include <QDebug>
+#include <QTemporaryFile>
+
+#include "TypingSimulator.h"
+#include "Headers/GP4k_ButtonsMapping.h"
+#include "Headers/KeyboardLayout.h"
+
+/**
+ * @def STICK_AMPLITUDE
+ * @brief The radius at which the synthetic user pushes the sticks.
+ *
+ * @details Lower than 1 on purpose: when a stick is released, its first axis going back to 0 must be enough to
+ * go under STICK_ENTER_RADIUS. With a diagonal at full amplitude, the remaining axis (0.707) would keep the stick at
+ * the border and move the selection to the neighbour tile, which a physical stick going back radially never does.
+ */
+#define STICK_AMPLITUDE 0.9
+
+TypingSimulator::TypingSimulator(const MotorModel_t Motor, const bool UseSuggestions)
+    : _Motor(Motor)
+    , _UseSuggestions(UseSuggestions)
+    , _Controller(new Controller())
+    , _TextField(new TextBuffer())
+    , _Dictionary(Trie::Shared())
+    , _CurrentGroup(0)
+    , _Report({0, 0, 0, 0, 0, 0, 0, 0.0})
+{
+    _Controller->SetDictionary(_Dictionary); // No event loop to wait for the background loading
+    QObject::connect(_Controller, &Controller::TypeToTextField, _TextField, &TextBuffer::InsertText);
+    QObject::connect(_Controller, &Controller::SendOrderToTextField, _TextField, &TextBuffer::OrderReceived);
+    _Controller->InitializeTilesContent();
+    BuildCharLocations();
+}
+
+TypingSimulator::~TypingSimulator()
+{
+    delete _TextField;
+    delete _Controller;
+}
+
+void TypingSimulator::BuildCharLocations(void){
+    const KeyboardLayout &Layout = KeyboardLayout::Active();
+    for(const CharIndexEntry_t &Entry : Layout.Chars()){
+        if(Entry.CodePoint <= 0xFFFFU){ // The text is read by QChar
+            _CharLocations.insert(QChar(static_cast<ushort>(Entry.CodePoint)),
+                                  {false, Entry.Position.Group, Entry.Position.Tile, Entry.Position.Shift, NO_CHAR_CAT});
+        }
+    }
+    for(const ShiftState_t Shift : {NOT_SHIFTED, SHIFTED}){
+        for(uint8_t Input = 0; Input < NUMBER_OF_INPUTS; Input++){
+            const feature_t &Feature = Layout.ButtonFeature(static_cast<GamepadInput_t>(Input), Shift);
+            if(Feature.FeatureType == PUNCTUATION || Feature.FeatureType == WORD_CONNECTOR){
+                const QChar Character = Feature.Text[1];
+                if(!_CharLocations.contains(Character)){
+                    _CharLocations.insert(Character, {true, Input, 0, Shift, Feature.FeatureType});
+                }
+            }
+        }
+    }
+}
+
+GamepadInput_t TypingSimulator::FindButton(const feature_t &Feature) const{
+    const GamepadInput_t Input = KeyboardLayout::Active().FindInput(Feature, NOT_SHIFTED);
+    if(Input == NUMBER_OF_INPUTS){
+        qFatal("No button is mapped to %s: the simulator can't type.", qPrintable(Feature.Text));
+    }
+    return Input;
+}
+
+QString TypingSimulator::Normalize(const QString &Line){
+    QString Normalized;
+    Normalized.reserve(Line.length() + 1);
+    for(QChar Character : Line){
+        if(Character == '\'' || Character == QChar(0x2018)){ Character = QChar(0x2019); } // The apostrophe of the layout is ’
+        if(Character.isSpace()){ Character = ' '; }
+
+        if(Character == ' ' || _CharLocations.contains(Character)){
+            Normalized.append(Character);
+        }else{
+            _Report.SkippedCharacters++;
+        }
+    }
+    Normalized.append(' '); // The end of line is typed as a space, so the last word is validated as the other ones
+    return Normalized;
+}
+
+QVector<Action_t> TypingSimulator::Plan(const QString &Target){
+    const int Length = Target.length();
+    const double Infinity = std::numeric_limits<double>::infinity();
+    const GamepadInput_t SpaceButton = FindButton(SPACE);
+    const GamepadInput_t BackspaceButton = FindButton(BACKSPACE);
+    const GamepadInput_t ShiftButton = FindButton(SHIFT);
+
+    /* State of the dynamic programming: [Position in the line][Selected char group].
+     * Transitions only go forward in the line, so the states are solved in order. */
+    struct State_t {
+        double Cost;
+        int Previous;
+        QVector<Action_t> Actions;
+    };
+    QVector<State_t> States((Length + 1) * NUMBER_OF_TILES, {Infinity, -1, {}});
+    auto StateIndex = [](const int Position, const uint8_t Group){ return Position * NUMBER_OF_TILES + Group; };
+    auto Relax = [&](const int From, const int Position, const uint8_t Group, const double Cost, const QVector<Action_t> &Actions){
+        State_t &Next = States[StateIndex(Position, Group)];
+        if(Cost < Next.Cost){
+            Next = {Cost, From, Actions};
+        }
+    };
+    States[StateIndex(0, _CurrentGroup)].Cost = 0.0;
+
+    int BufferStart = 0; // The autocompleter buffer holds Target[BufferStart, Position)
+    for(int Position = 0; Position < Length; Position++){
+        const QChar Character = Target[Position];
+
+        /* The suggestions only depend on the buffer and the group: they are
+         * sought once per group, then reused for every selected group. */
+        QVector<QPair<uint8_t, uint8_t>> Suggestions; // {Group, Tile}
+        const int WordEnd = Target.indexOf(' ', Position);
+        if(_UseSuggestions && BufferStart < Position && WordEnd > Position){
+            const QString Buffer = Target.mid(BufferStart, Position - BufferStart).toLower();
+            const QString Word = Target.mid(BufferStart, WordEnd - BufferStart);
+            for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+                const uint8_t NumberSuggestionTiles = KeyboardLayout::Active().SuggestionTiles(Group);
+                if(NumberSuggestionTiles == 0){ continue; }
+                const QVector<QString> Offered = _Dictionary->Suggest(Buffer, KeyboardLayout::Active().InnerChars(NOT_SHIFTED, Group));
+                for(uint8_t SuggestionIndex = 0; SuggestionIndex < qMin<int>(NumberSuggestionTiles, Offered.length()); SuggestionIndex++){
+                    // What is typed is the suggestion minus the buffer, so the typed part of the word can hold caps
+                    if(Offered[SuggestionIndex].mid(Position - BufferStart) == Word.mid(Position - BufferStart)){
+                        Suggestions.append({Group, static_cast<uint8_t>(MAX_TILE_INDEX - SuggestionIndex)});
+                    }
+                }
+            }
+        }
+
+        for(uint8_t Group = 0; Group < NUMBER_OF_TILES; Group++){
+            const int From = StateIndex(Position, Group);
+            const double Cost = States[From].Cost;
+            if(Cost == Infinity){ continue; }
+
+            if(Character == ' '){
+                Relax(From, Position + 1, Group, Cost + _Motor.ButtonPress, {{ACTION_BUTTON, SpaceButton}});
+            }else{
+                const CharLocation_t Location = _CharLocations.value(Character);
+                QVector<Action_t> Actions;
+                double ActionsCost = Cost;
+                if(Location.Shift == SHIFTED){
+                    Actions.append({ACTION_BUTTON, ShiftButton});
+                    ActionsCost += _Motor.ButtonPress;
+                }
+
+                if(!Location.IsButton){
+                    if(Location.Group != Group){
+                        Actions.append({ACTION_LEFT_STICK, Location.Group});
+                        ActionsCost += _Motor.StickMove;
+                    }
+                    Actions.append({ACTION_RIGHT_STICK, Location.Tile});
+                    Relax(From, Position + 1, Location.Group, ActionsCost + _Motor.StickMove, Actions);
+                }else{
+                    Actions.append({ACTION_BUTTON, Location.Group});
+                    ActionsCost += _Motor.ButtonPress;
+                    if(Location.FeatureType == WORD_CONNECTOR){
+                        Relax(From, Position + 1, Group, ActionsCost, Actions);
+                    }else if(Target[Position + 1] == ' '){ // Punctuations are followed by a space
+                        Relax(From, Position + 2, Group, ActionsCost, Actions);
+                    }else{ // ... that must be erased when the corpus does not have one
+                        Actions.append({ACTION_BUTTON, BackspaceButton});
+                        Relax(From, Position + 1, Group, ActionsCost + _Motor.ButtonPress, Actions);
+                    }
+                }
+            }
+
+            for(const auto &Suggestion : Suggestions){ // A suggestion types the end of the word and a space
+                QVector<Action_t> Actions;
+                double ActionsCost = Cost + _Motor.StickMove + _Motor.SuggestionReading;
+                if(Suggestion.first != Group){
+                    Actions.append({ACTION_LEFT_STICK, Suggestion.first});
+                    ActionsCost += _Motor.StickMove;
+                }
+                Actions.append({ACTION_RIGHT_STICK, Suggestion.second});
+                Relax(From, WordEnd + 1, Suggestion.first, ActionsCost, Actions);
+            }
+        }
+
+        const CharLocation_t Location = _CharLocations.value(Character);
+        if(Character == ' ' || (Location.IsButton && Location.FeatureType == PUNCTUATION)){
+            BufferStart = Position + 1;
+        }
+    }
+
+    int BestState = StateIndex(Length, 0);
+    for(uint8_t Group = 1; Group < NUMBER_OF_TILES; Group++){
+        if(States[StateIndex(Length, Group)].Cost < States[BestState].Cost){
+            BestState = StateIndex(Length, Group);
+        }
+    }
+
+    QVector<QVector<Action_t>> Steps;
+    for(int Current = BestState; States[Current].Previous != -1; Current = States[Current].Previous){
+        Steps.prepend(States[Current].Actions);
+    }
+    QVector<Action_t> Actions;
+    for(const QVector<Action_t> &Step : Steps){
+        Actions.append(Step);
+    }
+    return Actions;
+}
+
+void TypingSimulator::MoveStick(const stick_t Stick, const uint8_t Tile){
+    const GamepadInput_t InputX = (Stick == STICK_LEFT) ? INPUT_AXIS_LEFT_X : INPUT_AXIS_RIGHT_X;
+    const GamepadInput_t InputY = (Stick == STICK_LEFT) ? INPUT_AXIS_LEFT_Y : INPUT_AXIS_RIGHT_Y;
+    // Inverse of StickStateMachine::Update and StickStateMachine::SectorOf
+    const double Angle = (Tile * 45.0 - 180.0) * M_PI / 180.0;
+    SendInput(InputX, STICK_AMPLITUDE * cos(Angle));
+    SendInput(InputY, STICK_AMPLITUDE * sin(Angle));
+    SendInput(InputX, 0.0);
+    SendInput(InputY, 0.0);
+}
+
+void TypingSimulator::SendInput(const GamepadInput_t Input, const double Value){
+    _Controller->HandleTimedInput(Input, Value, static_cast<quint64>(std::llround(_Report.SimulatedTime * 1000.0)));
+}
+
+void TypingSimulator::Execute(const QVector<Action_t> &Actions){
+    for(const Action_t &Action : Actions){
+        switch (Action.Type) {
+        case ACTION_LEFT_STICK:
+            MoveStick(STICK_LEFT, Action.Param);
+            _CurrentGroup = Action.Param;
+            _Report.StickMoves++;
+            _Report.SimulatedTime += _Motor.StickMove;
+            break;
+        case ACTION_RIGHT_STICK:
+            MoveStick(STICK_RIGHT, Action.Param);
+            _Report.StickMoves++;
+            _Report.SimulatedTime += _Motor.StickMove;
+            if(Action.Param > KeyboardLayout::Active().LastCharTile(_CurrentGroup)){
+                _Report.AcceptedSuggestions++;
+                _Report.SimulatedTime += _Motor.SuggestionReading;
+            }
+            break;
+        case ACTION_BUTTON:
+            SendInput(static_cast<GamepadInput_t>(Action.Param), 1.0);
+            SendInput(static_cast<GamepadInput_t>(Action.Param), 0.0);
+            _Report.ButtonPresses++;
+            _Report.SimulatedTime += _Motor.ButtonPress;
+            break;
+        default:
+            // Action.Type is enum type ActionType_t: No other possible option
+            break;
+        }
+    }
+}
+
+void TypingSimulator::TypeLine(const QString &Line){
+    const QString Target = Normalize(Line);
+    Execute(Plan(Target));
+
+    _Report.Characters += Target.length();
+    _Report.Words += Target.split(' ', Qt::SkipEmptyParts).length();
+
+    const QString Typed = _TextField->Text();
+    _RecordedText += Typed;
+    if(Typed != Target){
+        if(_Report.MismatchedLines < 10){
+            qWarning() << "Expected:" << Target;
+            qWarning() << "Typed:   " << Typed;
+        }
+        _Report.MismatchedLines++;
+    }
+    _TextField->Clear();
+}
+
+SimulationReport_t TypingSimulator::GetReport(void) const{
+    return _Report;
+}
+
+void TypingSimulator::StartRecording(void){
+    _RecordedText.clear();
+    _Controller->SetRecorder(&_Recorder);
+}
+
+bool TypingSimulator::CheckReplay(void){
+    QTemporaryFile LogFile;
+    InputLog_t Log;
+    if(!LogFile.open() || !_Recorder.Save(LogFile.fileName(), _RecordedText) || !InputRecorder::Load(LogFile.fileName(), Log)){
+        qWarning() << "The input log can't be written and read back";
+        return false;
+    }
+
+    Controller Replayed;
+    TextBuffer ReplayedField;
+    Replayed.SetDictionary(_Dictionary);
+    QObject::connect(&Replayed, &Controller::TypeToTextField, &ReplayedField, &TextBuffer::InsertText);
+    QObject::connect(&Replayed, &Controller::SendOrderToTextField, &ReplayedField, &TextBuffer::OrderReceived);
+    Replayed.InitializeTilesContent();
+    for(const InputEvent_t &Event : Log.Events){ // As InputReplayer does, without waiting for an event loop
+        Replayed.HandleTimedInput(Event.Input, Event.Value, Event.Timestamp);
+    }
+
+    if(ReplayedField.Text() != Log.ExpectedText){
+        qWarning() << "The replay of" << Log.Events.length() << "events differs from the recording";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,242 @@
+/* TypingSimulator.h */
+
+#ifndef TYPINGSIMULATOR_H
+#define TYPINGSIMULATOR_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "Headers/Controller.h"
+#include "Headers/InputRecorder.h"
+#include "Headers/TextBuffer.h"
+#include "Headers/Trie.h"
+
+/**
+ * @brief Durations, in milliseconds, of the elementary actions of the synthetic user.
+ */
+struct MotorModel_t {
+    /**
+     * @brief Time to push a stick to the border and release it.
+     */
+    double StickMove;
+
+    /**
+     * @brief Time to press and release a button.
+     */
+    double ButtonPress;
+
+    /**
+     * @brief Additional time to read a suggestion tile before selecting it.
+     */
+    double SuggestionReading;
+};
+
+/**
+ * @brief Represents the elementary actions the synthetic user can perform.
+ */
+enum ActionType_t {
+    ACTION_LEFT_STICK,   /**< Selects a char group. Param is the group index. */
+    ACTION_RIGHT_STICK,  /**< Selects a char or a suggestion. Param is the tile index. */
+    ACTION_BUTTON        /**< Presses a button. Param is a GamepadInput_t. */
+};
+
+/**
+ * @brief Describes an elementary action of the synthetic user.
+ */
+struct Action_t {
+    ActionType_t Type;
+    uint8_t Param;
+};
+
+/**
+ * @brief Describes how to reach a character: a tile of the inner tile group, or a button.
+ */
+struct CharLocation_t {
+    /**
+     * @brief True if the character is typed with a button, false if it's on a tile.
+     */
+    bool IsButton;
+
+    /**
+     * @brief The group of the tile, or the GamepadInput_t of the button.
+     */
+    uint8_t Group;
+
+    /**
+     * @brief The index of the tile in its group. Unused for buttons.
+     */
+    uint8_t Tile;
+
+    /**
+     * @brief The shift state required to reach the character.
+     */
+    ShiftState_t Shift;
+
+    /**
+     * @brief The type of the button's feature. Unused for tiles.
+     */
+    FeatureType_t FeatureType;
+};
+
+/**
+ * @brief Holds the measurements of a simulation.
+ */
+struct SimulationReport_t {
+    int Characters;              /**< Characters of the corpus typed, spaces included. */
+    int Words;                   /**< Words of the corpus. */
+    int SkippedCharacters;       /**< Characters of the corpus that can't be typed with the current layout. */
+    int StickMoves;              /**< Moves of the left and right sticks. */
+    int ButtonPresses;           /**< Presses on buttons, shift included. */
+    int AcceptedSuggestions;     /**< Words completed with a suggestion tile. */
+    int MismatchedLines;         /**< Lines for which the text field differs from the corpus. */
+    double SimulatedTime;        /**< Milliseconds spent by the synthetic user, according to the motor model. */
+};
+
+/**
+ * @brief The TypingSimulator class types a corpus with an optimal-policy synthetic user, driving the real Controller.
+ *
+ * @details For each line of the corpus, the simulator plans the cheapest sequence of actions (according to the motor
+ * model) with a dynamic programming over the positions in the line and the selected char group. At each position, the
+ * user either types the next character (changing the char group if needed) or selects a suggestion tile of any group
+ * offering the end of the current word. The plan is then executed through Controller::HandleInput, and the resulting
+ * text field is compared to the corpus.
+ */
+class TypingSimulator {
+public: // Methods
+    /**
+     * @brief Constructor of the TypingSimulator.
+     * @param Motor The durations of the elementary actions.
+     * @param UseSuggestions False to simulate a user ignoring the suggestion tiles.
+     */
+    TypingSimulator(const MotorModel_t Motor, const bool UseSuggestions);
+
+    /**
+     * @brief Destructor of the TypingSimulator.
+     */
+    ~TypingSimulator();
+
+    /**
+     * @brief Types a line of the corpus, followed by a space.
+     * @param Line The line to type.
+     */
+    void TypeLine(const QString &Line);
+
+    /**
+     * @brief Getter for the measurements.
+     * @return The measurements accumulated since the construction.
+     */
+    SimulationReport_t GetReport(void) const;
+
+    /**
+     * @brief Records the inputs sent to the Controller from now on, for CheckReplay.
+     */
+    void StartRecording(void);
+
+    /**
+     * @brief Saves the recorded inputs as GP4k --record does, loads them back and replays them in a new Controller.
+     * @return True if the replay types the text typed since StartRecording, false else or if the log can't be
+     * written or read.
+     */
+    bool CheckReplay(void);
+
+private: // Methods
+    /**
+     * @brief Fills _CharLocations from the tiles and buttons mappings.
+     */
+    void BuildCharLocations(void);
+
+    /**
+     * @brief Replaces the characters of the corpus that have a typeable equivalent, and drops the other ones.
+     * @param Line The line to normalize.
+     * @return The normalized line.
+     */
+    QString Normalize(const QString &Line);
+
+    /**
+     * @brief Computes the cheapest actions to type a line.
+     * @param Target The normalized line, ending with a space.
+     * @return The actions to perform.
+     */
+    QVector<Action_t> Plan(const QString &Target);
+
+    /**
+     * @brief Sends the actions to the Controller.
+     * @param Actions The actions to perform.
+     */
+    void Execute(const QVector<Action_t> &Actions);
+
+    /**
+     * @brief Pushes a stick to a tile and releases it, as a user would do.
+     * @param Stick The stick to move.
+     * @param Tile The index of the tile to select.
+     */
+    void MoveStick(const stick_t Stick, const uint8_t Tile);
+
+    /**
+     * @brief Sends an input to the Controller, timestamped with the simulated time.
+     * @param Input The physical input that changed.
+     * @param Value The new value of the input.
+     */
+    void SendInput(const GamepadInput_t Input, const double Value);
+
+    /**
+     * @brief Returns the input of the first button triggering a feature.
+     * @param Feature The feature to look for.
+     * @return The input of the button.
+     */
+    GamepadInput_t FindButton(const feature_t &Feature) const;
+
+private: // Attributes
+    /**
+     * @brief The durations of the elementary actions.
+     */
+    MotorModel_t _Motor;
+
+    /**
+     * @brief False if the synthetic user ignores the suggestion tiles.
+     */
+    bool _UseSuggestions;
+
+    /**
+     * @brief The Controller driven by the synthetic user.
+     */
+    Controller *_Controller;
+
+    /**
+     * @brief The text field receiving the Controller outputs.
+     */
+    TextBuffer *_TextField;
+
+    /**
+     * @brief The dictionary used to plan the suggestions, the one the Controller queries.
+     */
+    QSharedPointer<const Trie> _Dictionary;
+
+    /**
+     * @brief Where to find each typeable character.
+     */
+    QHash<QChar, CharLocation_t> _CharLocations;
+
+    /**
+     * @brief The char group currently selected by the Controller.
+     */
+    uint8_t _CurrentGroup;
+
+    /**
+     * @brief The measurements accumulated since the construction.
+     */
+    SimulationReport_t _Report;
+
+    /**
+     * @brief The inputs sent to the Controller since StartRecording.
+     */
+    InputRecorder _Recorder;
+
+    /**
+     * @brief The text typed since StartRecording, the lines following each other as in a single text field.
+     */
+    QString _RecordedText;
+};
+
+#endif // TYPINGSIMULATOR_H
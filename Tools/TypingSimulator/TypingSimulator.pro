@@ -0,0 +1,19 @@
+# Headless typing simulator: types a corpus through the real Controller and
+# reports moves per character, suggestion acceptance and simulated speed.
+
+QT -= gui
+QT += core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = gp4k-simulator
+
+include(../../GP4k_Engine.pri)
+
+SOURCES += \
+    main.cpp \
+    TypingSimulator.cpp
+
+HEADERS += \
+    TypingSimulator.h
@@ -0,0 +1,90 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+
+#include "Headers/KeyboardLayout.h"
+#include "TypingSimulator.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser Parser;
+    Parser.setApplicationDescription("Types a corpus with an optimal-policy synthetic user driving the GP4k Controller.");
+    Parser.addHelpOption();
+    Parser.addPositionalArgument("corpus", "The text file to type, read line by line.");
+    const QCommandLineOption StickOption("stick-ms", "Time to move a stick to a tile and release it.", "ms", "300");
+    const QCommandLineOption ButtonOption("button-ms", "Time to press a button.", "ms", "200");
+    const QCommandLineOption SuggestionOption("suggestion-ms", "Time to read a suggestion before selecting it.", "ms", "150");
+    const QCommandLineOption NoSuggestionsOption("no-suggestions", "Never use the suggestion tiles.");
+    const QCommandLineOption MaxLinesOption("max-lines", "Stop after <lines> lines of the corpus.", "lines", "0");
+    const QCommandLineOption LayoutOption("layout", "Type with the layout of <file>, text or compiled, instead of the built-in one.", "file");
+    const QCommandLineOption CheckReplayOption("check-replay", "Record the inputs, then check their replay types the same text.");
+    Parser.addOptions({StickOption, ButtonOption, SuggestionOption, NoSuggestionsOption, MaxLinesOption, LayoutOption, CheckReplayOption});
+    Parser.process(a);
+
+    if(Parser.positionalArguments().length() != 1){
+        Parser.showHelp(2);
+    }
+
+    QFile CorpusFile(Parser.positionalArguments()[0]);
+    if(!CorpusFile.open(QIODevice::ReadOnly | QIODevice::Text)){
+        qCritical() << "Cannot open" << CorpusFile.fileName();
+        return 2;
+    }
+
+    if(Parser.isSet(LayoutOption)){ // Before the Controller reads it
+        KeyboardLayout Layout;
+        QStringList Errors;
+        if(!KeyboardLayout::Load(Parser.value(LayoutOption), Layout, Errors)){
+            qCritical().noquote().nospace() << "Invalid layout " << Parser.value(LayoutOption) << ":\n    " << Errors.join("\n    ");
+            return 2;
+        }
+        KeyboardLayout::SetActive(Layout);
+    }
+
+    const MotorModel_t Motor = {
+        Parser.value(StickOption).toDouble(),
+        Parser.value(ButtonOption).toDouble(),
+        Parser.value(SuggestionOption).toDouble()
+    };
+    if(!Trie::Shared()->IsLoaded()){ // The planned suggestions would be none
+        return 2;
+    }
+    TypingSimulator Simulator(Motor, !Parser.isSet(NoSuggestionsOption));
+    if(Parser.isSet(CheckReplayOption)){
+        Simulator.StartRecording();
+    }
+
+    const int MaxLines = Parser.value(MaxLinesOption).toInt();
+    QTextStream CorpusStream(&CorpusFile);
+    CorpusStream.setCodec("UTF-8");
+    for(int LineIndex = 0; !CorpusStream.atEnd() && (MaxLines == 0 || LineIndex < MaxLines); LineIndex++){
+        Simulator.TypeLine(CorpusStream.readLine());
+    }
+
+    const SimulationReport_t Report = Simulator.GetReport();
+    const double Characters = qMax(Report.Characters, 1);
+    const double MinutesSimulated = Report.SimulatedTime / 60000.0;
+    QTextStream Out(stdout);
+    Out << "characters: " << Report.Characters << "\n"
+        << "words: " << Report.Words << "\n"
+        << "skipped_characters: " << Report.SkippedCharacters << "\n"
+        << "stick_moves: " << Report.StickMoves << "\n"
+        << "button_presses: " << Report.ButtonPresses << "\n"
+        << "moves_per_char: " << Report.StickMoves / Characters << "\n"
+        << "actions_per_char: " << (Report.StickMoves + Report.ButtonPresses) / Characters << "\n"
+        << "accepted_suggestions: " << Report.AcceptedSuggestions << "\n"
+        << "suggestion_acceptance_rate: " << static_cast<double>(Report.AcceptedSuggestions) / qMax(Report.Words, 1) << "\n"
+        << "ms_per_char: " << Report.SimulatedTime / Characters << "\n"
+        << "words_per_minute: " << ((MinutesSimulated > 0) ? (Characters / 5.0) / MinutesSimulated : 0.0) << "\n"
+        << "mismatched_lines: " << Report.MismatchedLines << "\n";
+
+    bool ReplayMatches = true;
+    if(Parser.isSet(CheckReplayOption)){
+        ReplayMatches = Simulator.CheckReplay();
+        Out << "replay_matches: " << (ReplayMatches ? "yes" : "no") << "\n";
+    }
+    return (Report.MismatchedLines == 0 && ReplayMatches) ? 0 : 1;
+}